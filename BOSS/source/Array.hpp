@@ -2,43 +2,48 @@
 #include "BOSSAssert.h"
 #include "Common.h"
 #include <algorithm>
+#include <type_traits>
 
 namespace BOSS
 {
+// the narrowest unsigned type which can hold a size up to max_capacity, so small Vecs stay small
+template <size_t max_capacity>
+struct VecSizeType
+{
+    typedef typename std::conditional<(max_capacity <= 0xFF), unsigned char,
+            typename std::conditional<(max_capacity <= 0xFFFF), unsigned short, size_t>::type>::type type;
+};
+
 template <class T,size_t max_capacity>
 class Vec
 {
-    size_t	_size;
-    size_t  _capacity;
-    T		_arr[max_capacity];
+    T		                                    _arr[max_capacity];
+    typename VecSizeType<max_capacity>::type    _size;
 
 public:
 
     Vec<T,max_capacity>()
         : _size(0)
-        ,_capacity(max_capacity)
     {
 		BOSS_ASSERT(max_capacity>0, "Vec initializing with capacity = 0");
     }
 
     Vec<T,max_capacity>(const size_t & size)
         : _size(size)
-        ,_capacity(max_capacity)
     {
-        BOSS_ASSERT(size <= max_capacity,"Vec initializing with size > capacity, Size = %d, Capacity = %d",size,_capacity);
+        BOSS_ASSERT(size <= max_capacity,"Vec initializing with size > capacity, Size = %d, Capacity = %d",size,max_capacity);
     }
 
     Vec<T,max_capacity>(const size_t & size,const T & val)
         : _size(size)
-        ,_capacity(max_capacity)
     {
-        BOSS_ASSERT(size <= max_capacity,"Vec initializing with size > capacity, Size = %d, Capacity = %d",size,_capacity);
+        BOSS_ASSERT(size <= max_capacity,"Vec initializing with size > capacity, Size = %d, Capacity = %d",size,max_capacity);
         fill(val);
     }
     
     void resize(const size_t & size)
     {
-        BOSS_ASSERT(size <= max_capacity,"Vec resizing with size > capacity, Size = %d, Cpacity = %d",size,_capacity);
+        BOSS_ASSERT(size <= max_capacity,"Vec resizing with size > capacity, Size = %d, Cpacity = %d",size,max_capacity);
         _size = size;
     }
 
@@ -119,9 +124,9 @@ public:
         _size--;
     }
     
-    const size_t & capacity() const
+    const size_t capacity() const
     {
-        return _capacity;
+        return max_capacity;
     }
 
     void push_back(const T & e)
@@ -178,7 +183,7 @@ public:
         _size = 0;
     }
 
-    const size_t & size() const
+    const size_t size() const
     {
         return _size;
     }
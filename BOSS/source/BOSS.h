@@ -6,6 +6,7 @@
 #include "CombatSearch_Integral.h"
 #include "CombatSearch_Bucket.h"
 #include "CombatSearch_BestResponse.h"
+#include "CombatSearch_MCTS.h"
 #include "ActionTypeData.h"
 #include "Timer.hpp"
 #include "ActionType.h"
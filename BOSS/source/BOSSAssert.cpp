@@ -1,6 +1,9 @@
 #include "BOSSAssert.h"
 #include "BOSSException.h"
 
+#include <cstring>
+#include <ctime>
+
 using namespace BOSS;
 
 namespace BOSS
@@ -2,9 +2,71 @@
 
 #include "CombatSearchExperiment.h"
 #include "BOSSPlotBuildOrders.h"
+#include "BuildOrderTester.h"
+#include "Timer.hpp"
+#include <set>
+#include <map>
+
+#if !defined(WIN32) && !defined(EMSCRIPTEN)
+    #define BOSS_EXPERIMENTS_FORK
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/wait.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
 
 using namespace BOSS;
 
+Experiments::ExperimentRunnerParameters::ExperimentRunnerParameters()
+    : workers(1)
+    , logDir("")
+{
+
+}
+
+// returns the names of the experiments which have already finished according to the resume file
+static std::set<std::string> ReadFinishedExperiments(const std::string & resumeFile)
+{
+    std::set<std::string> finished;
+    std::ifstream fin(resumeFile.c_str());
+    std::string line;
+
+    while (std::getline(fin, line))
+    {
+        if (!line.empty())
+        {
+            finished.insert(line);
+        }
+    }
+
+    return finished;
+}
+
+static void WriteFinishedExperiment(const std::string & resumeFile, const std::string & name)
+{
+    if (resumeFile.empty())
+    {
+        return;
+    }
+
+    std::ofstream fout(resumeFile.c_str(), std::ios::app);
+    fout << name << std::endl;
+}
+
+#ifdef BOSS_EXPERIMENTS_FORK
+// the log file of an experiment run by a worker, LogDir may be given with or without a trailing separator
+static std::string GetLogFile(const std::string & logDir, const std::string & name)
+{
+    if (logDir.empty() || logDir.back() == '/' || logDir.back() == '\\')
+    {
+        return logDir + name + ".log";
+    }
+
+    return logDir + "/" + name + ".log";
+}
+#endif
+
 void Experiments::RunExperiments(const std::string & experimentFilename)
 {
     rapidjson::Document document;
@@ -12,7 +74,35 @@ void Experiments::RunExperiments(const std::string & experimentFilename)
 
     BOSS_ASSERT(document.HasMember("Experiments"), "No 'Experiments' member found");
 
+    ExperimentRunnerParameters runnerParams;
+    if (document.HasMember("ExperimentRunner"))
+    {
+        const rapidjson::Value & runnerVal = document["ExperimentRunner"];
+        BOSS_ASSERT(runnerVal.IsObject(), "ExperimentRunner should be an object");
+
+        if (runnerVal.HasMember("Workers"))
+        {
+            BOSS_ASSERT(runnerVal["Workers"].IsInt() && runnerVal["Workers"].GetInt() > 0, "ExperimentRunner 'Workers' should be a positive int");
+            runnerParams.workers = runnerVal["Workers"].GetInt();
+        }
+
+        if (runnerVal.HasMember("LogDir"))
+        {
+            BOSS_ASSERT(runnerVal["LogDir"].IsString(), "ExperimentRunner 'LogDir' should be a string");
+            runnerParams.logDir = runnerVal["LogDir"].GetString();
+        }
+
+        if (runnerVal.HasMember("ResumeFile"))
+        {
+            BOSS_ASSERT(runnerVal["ResumeFile"].IsString(), "ExperimentRunner 'ResumeFile' should be a string");
+            runnerParams.resumeFile = runnerVal["ResumeFile"].GetString();
+        }
+    }
+
+    const std::set<std::string> finished = ReadFinishedExperiments(runnerParams.resumeFile);
+
     const rapidjson::Value & experiments = document["Experiments"];
+    std::vector<std::string> names;
     for (rapidjson::Value::ConstMemberIterator itr = experiments.MemberBegin(); itr != experiments.MemberEnd(); ++itr)
     {
         const std::string &         name = itr->name.GetString();
@@ -22,25 +112,154 @@ void Experiments::RunExperiments(const std::string & experimentFilename)
         BOSS_ASSERT(val.HasMember("Type") && val["Type"].IsString(), "Experiment has no 'Type' string");
 
         if (val.HasMember("Run") && val["Run"].IsBool() && (val["Run"].GetBool() == true))
-        {   
-            const std::string & type = val["Type"].GetString();
-
-            if (type == "CombatSearch")
-            {
-                RunCombatExperiment(name, val);
-            }
-            else if (type == "BuildOrderPlot")
+        {
+            if (finished.find(name) != finished.end())
             {
-                RunBuildOrderPlot(name, val);
+                std::cout << "Skipping finished experiment: " << name << std::endl;
+                continue;
             }
-            else
+
+            names.push_back(name);
+        }
+    }
+
+#ifdef BOSS_EXPERIMENTS_FORK
+    if (runnerParams.workers > 1)
+    {
+        RunExperimentsInParallel(names, experiments, runnerParams);
+        std::cout << "\n\n";
+        return;
+    }
+#endif
+
+    for (size_t i(0); i < names.size(); ++i)
+    {
+        RunExperiment(names[i], experiments[names[i].c_str()]);
+        WriteFinishedExperiment(runnerParams.resumeFile, names[i]);
+    }
+
+    std::cout << "\n\n";
+}
+
+void Experiments::RunExperiment(const std::string & name, const rapidjson::Value & val)
+{
+    const std::string & type = val["Type"].GetString();
+
+    if (type == "CombatSearch")
+    {
+        RunCombatExperiment(name, val);
+    }
+    else if (type == "BuildOrderPlot")
+    {
+        RunBuildOrderPlot(name, val);
+    }
+    else if (type == "BuildOrderBenchmark")
+    {
+        RunBuildOrderBenchmark(name, val);
+    }
+    else
+    {
+        BOSS_ASSERT(false, "Unknown Experiment Type: %s", type.c_str());
+    }
+}
+
+// Runs up to params.workers experiments at once, each in a forked child process
+// Experiments print everything to stdout, so a child's output is redirected to its own log file
+// which is printed as soon as it finishes. A failing experiment only takes down its own process.
+void Experiments::RunExperimentsInParallel(const std::vector<std::string> & names, const rapidjson::Value & experiments, const ExperimentRunnerParameters & params)
+{
+#ifdef BOSS_EXPERIMENTS_FORK
+    std::map<pid_t, size_t> running;
+    std::map<pid_t, Timer>  timers;
+    size_t next = 0;
+    size_t failed = 0;
+
+    std::cout.flush();
+    fflush(stdout);
+
+    while (next < names.size() || !running.empty())
+    {
+        // start experiments until all the workers are busy
+        while (next < names.size() && running.size() < (size_t)params.workers)
+        {
+            const std::string logFile = GetLogFile(params.logDir, names[next]);
+            pid_t pid = fork();
+            BOSS_ASSERT(pid >= 0, "Couldn't fork experiment worker for %s", names[next].c_str());
+
+            if (pid == 0)
             {
-                BOSS_ASSERT(false, "Unknown Experiment Type: %s", type.c_str());
+                // writing to the shared stdout would interleave with the other workers, so fail instead
+                int fd = open(logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if (fd < 0)
+                {
+                    std::cerr << "Couldn't open experiment log " << logFile << ": " << strerror(errno) << std::endl;
+                    _exit(1);
+                }
+
+                dup2(fd, STDOUT_FILENO);
+                dup2(fd, STDERR_FILENO);
+                close(fd);
+
+                int status = 0;
+                try
+                {
+                    RunExperiment(names[next], experiments[names[next].c_str()]);
+                }
+                catch (const std::exception & e)
+                {
+                    std::cout << e.what() << std::endl;
+                    status = 1;
+                }
+
+                std::cout.flush();
+                fflush(stdout);
+                _exit(status);
             }
+
+            std::cout << "Started experiment: " << names[next] << " (pid " << pid << ")" << std::endl;
+            running[pid] = next;
+            timers[pid].start();
+            next++;
+        }
+
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0 || running.find(pid) == running.end())
+        {
+            continue;
+        }
+
+        const std::string & name = names[running[pid]];
+        const bool success = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+        const double ms = timers[pid].getElapsedTimeInMilliSec();
+        running.erase(pid);
+        timers.erase(pid);
+
+        // stream the finished experiment's output in one piece
+        // a worker that couldn't open its log has none, and streaming an empty buffer would fail std::cout
+        std::ifstream log(GetLogFile(params.logDir, name).c_str());
+        if (log.is_open() && log.peek() != std::ifstream::traits_type::eof())
+        {
+            std::cout << "\n" << log.rdbuf();
+        }
+        std::cout << "\nFinished experiment: " << name << (success ? "" : " [FAILED]") << " in " << ms << "ms, "
+                  << (names.size() - next + running.size()) << " remaining" << std::endl;
+
+        if (success)
+        {
+            WriteFinishedExperiment(params.resumeFile, name);
+        }
+        else
+        {
+            failed++;
         }
     }
 
-    std::cout << "\n\n";
+    if (failed > 0)
+    {
+        std::cout << "\n" << failed << " experiment(s) failed and will be run again when resuming" << std::endl;
+    }
+#endif
 }
 
 void Experiments::RunCombatExperiment(const std::string & name, const rapidjson::Value & val)
@@ -53,4 +272,9 @@ void Experiments::RunBuildOrderPlot(const std::string & name, const rapidjson::V
 {
     BOSSPlotBuildOrders plot(name, val);
     plot.doPlots();
+}
+
+void Experiments::RunBuildOrderBenchmark(const std::string & name, const rapidjson::Value & val)
+{
+    BuildOrderTester::RunBenchmark(name, val);
 }
\ No newline at end of file
@@ -10,10 +10,32 @@ namespace BOSS
 
 namespace Experiments
 {
+    // Optional top level 'ExperimentRunner' object of the experiment file
+    //
+    //      Workers:    number of experiments run at the same time, each in its own forked process
+    //                  whose output goes to LogDir/<name>.log and is printed when it finishes.
+    //                  Platforms without fork (Windows, emscripten) always run one at a time.
+    //      LogDir:     directory the worker logs are written to
+    //      ResumeFile: every experiment that finishes successfully is appended to this file, and
+    //                  experiments already listed in it are skipped, so an interrupted experiment
+    //                  file can be resumed by running it again
+    class ExperimentRunnerParameters
+    {
+    public:
+        int         workers;
+        std::string logDir;
+        std::string resumeFile;
+
+        ExperimentRunnerParameters();
+    };
+
     void RunExperiments(const std::string & experimentFilename);
+    void RunExperiment(const std::string & name, const rapidjson::Value & val);
+    void RunExperimentsInParallel(const std::vector<std::string> & names, const rapidjson::Value & experiments, const ExperimentRunnerParameters & params);
 
     void RunCombatExperiment(const std::string & name, const rapidjson::Value & val);
     void RunBuildOrderPlot(const std::string & name, const rapidjson::Value & val);
+    void RunBuildOrderBenchmark(const std::string & name, const rapidjson::Value & val);
 }
 
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
 #include "BuildOrderTester.h"
 #include "JSONTools.h"
 #include "NaiveBuildOrderSearch.h"
+#include "BOSSParameters.h"
 
 using namespace BOSS;
 
-BuildOrderSearchGoal BuildOrderTester::GetRandomGoal(const RaceID race)
+BuildOrderSearchGoal BuildOrderTester::GetRandomGoal(const RaceID race, std::mt19937 & rng)
 {
     BuildOrderSearchGoal goal(race);
     
@@ -16,7 +17,7 @@ BuildOrderSearchGoal BuildOrderTester::GetRandomGoal(const RaceID race)
 
     for (size_t i(0); i < numUnits; ++i)
     {
-        const ActionType randomAction = allActionTypes[rand() % totalActionTypes];
+        const ActionType randomAction = allActionTypes[rng() % totalActionTypes];
 
         if (randomAction.getUnitType() == BWAPI::UnitTypes::Protoss_Dark_Archon ||
             randomAction.getUnitType() == BWAPI::UnitTypes::Protoss_Archon ||
@@ -25,7 +26,7 @@ BuildOrderSearchGoal BuildOrderTester::GetRandomGoal(const RaceID race)
             continue;
         }
 
-        int numToAdd = rand() % maxOfUnit;
+        int numToAdd = rng() % maxOfUnit;
 
         if (randomAction.isUnit() && !randomAction.isRefinery())
         {
@@ -45,14 +46,22 @@ void BuildOrderTester::TestRandomBuilds(const RaceID race, const size_t numTests
 {
     for (size_t i(0); i < numTests; ++i)
     {
-        GameState state = GetStartState(race, 20);            
+        std::mt19937 rng((unsigned int)time(NULL) + (unsigned int)i);
+        GameState state = GetStartState(race, 20, rng);
     }
 }
 
-GameState BuildOrderTester::GetStartState(const RaceID race, int randomActions)
+GameState BuildOrderTester::GetStartState(const RaceID race, int randomActions, std::mt19937 & rng)
 {
     GameState state(race);
     state.setStartingState();
+
+    return GetStartState(state, randomActions, rng);
+}
+
+GameState BuildOrderTester::GetStartState(const GameState & initialState, int randomActions, std::mt19937 & rng)
+{
+    GameState state(initialState);
     GameState copyState(state);
     
     BuildOrder randomBuildOrder;
@@ -70,11 +79,11 @@ GameState BuildOrderTester::GetStartState(const RaceID race, int randomActions)
                 std::cout << i << " Legal Actions Empty!" << std::endl;
                 std::cout << randomBuildOrder.getNumberedString() << std::endl;
                 std::cout << state.toString() << std::endl;
-               
+                break;
             }
 
 
-            ActionType randomAction = legalActions[rand() % legalActions.size()];
+            ActionType randomAction = legalActions[rng() % legalActions.size()];
 
            
 
@@ -121,7 +130,7 @@ void BuildOrderTester::DoRandomTests(const RaceID race, const size_t numTests)
     GameState startState(race);
     startState.setStartingState();
     
-    srand((int)time(NULL));
+    std::mt19937 rng((unsigned int)time(NULL));
 
     for (size_t i(0); i < numTests; ++i)
     {
@@ -131,7 +140,7 @@ void BuildOrderTester::DoRandomTests(const RaceID race, const size_t numTests)
         }
 
         //GameState startState = GetStartState(race, 20);
-        BuildOrderSearchGoal goal = GetRandomGoal(race);
+        BuildOrderSearchGoal goal = GetRandomGoal(race, rng);
         
         NaiveBuildOrderSearch naiveSearch(startState, goal);
         
@@ -172,4 +181,407 @@ void BuildOrderTester::DoRandomTests(const RaceID race, const size_t numTests)
 
         }
     }
-}
\ No newline at end of file
+}
+
+BuildOrderTester::BenchmarkResult::BenchmarkResult()
+    : goalIndex(0)
+    , solved(false)
+    , makespan(-1)
+    , nodesExpanded(0)
+    , timeElapsed(0)
+{
+
+}
+
+double BuildOrderTester::BenchmarkResult::nodesPerSec() const
+{
+    return timeElapsed > 0 ? (1000.0 * nodesExpanded / timeElapsed) : 0;
+}
+
+std::string BuildOrderTester::BenchmarkResult::getKey() const
+{
+    std::stringstream ss;
+    ss << race << "," << goalIndex << "," << search;
+    return ss.str();
+}
+
+std::string BuildOrderTester::BenchmarkResult::getCSVString() const
+{
+    std::stringstream ss;
+    ss << getKey() << "," << (solved ? 1 : 0) << "," << makespan << "," << nodesExpanded << "," << timeElapsed << "," << nodesPerSec();
+    return ss.str();
+}
+
+std::string BuildOrderTester::BenchmarkResult::getJSONString() const
+{
+    std::stringstream ss;
+    ss << "{\"Race\" : \"" << race << "\", \"Goal\" : " << goalIndex << ", \"Search\" : \"" << search << "\", ";
+    ss << "\"Solved\" : " << (solved ? "true" : "false") << ", \"Makespan\" : " << makespan << ", ";
+    ss << "\"Nodes\" : " << nodesExpanded << ", \"TimeMS\" : " << timeElapsed << ", \"NodesPerSec\" : " << nodesPerSec() << "}";
+    return ss.str();
+}
+
+// Runs every search on a fixed corpus of random goals for each race and writes the results
+// The corpus only depends on the seed, so results can be compared against a previous run
+// of the same experiment stored as a baseline csv file
+void BuildOrderTester::RunBenchmark(const std::string & name, const rapidjson::Value & val)
+{
+    BOSS_ASSERT(val.HasMember("Races") && val["Races"].IsArray(), "Benchmark has no 'Races' array");
+    BOSS_ASSERT(val.HasMember("GoalsPerRace") && val["GoalsPerRace"].IsInt(), "Benchmark has no 'GoalsPerRace' int");
+    BOSS_ASSERT(val.HasMember("SearchTimeLimitMS") && val["SearchTimeLimitMS"].IsInt(), "Benchmark has no 'SearchTimeLimitMS' int");
+    BOSS_ASSERT(val.HasMember("OutputFile") && val["OutputFile"].IsString(), "Benchmark has no 'OutputFile' string");
+
+    const rapidjson::Value & races = val["Races"];
+    const size_t goalsPerRace = val["GoalsPerRace"].GetInt();
+    const int timeLimitMS = val["SearchTimeLimitMS"].GetInt();
+    const std::string outputFile = val["OutputFile"].GetString();
+    const unsigned int seed = (val.HasMember("Seed") && val["Seed"].IsInt()) ? val["Seed"].GetInt() : 0;
+    const int startActions = (val.HasMember("StartActions") && val["StartActions"].IsInt()) ? val["StartActions"].GetInt() : 10;
+
+    std::vector<std::string> searches;
+    if (val.HasMember("Searches") && val["Searches"].IsArray())
+    {
+        for (size_t s(0); s < val["Searches"].Size(); ++s)
+        {
+            BOSS_ASSERT(val["Searches"][s].IsString(), "Benchmark search type must be a string");
+            searches.push_back(val["Searches"][s].GetString());
+        }
+    }
+    else
+    {
+        searches.push_back("Naive");
+        searches.push_back("DFBB");
+        searches.push_back("Smart");
+    }
+
+    // optional per race states and opening build orders, so a race can be benchmarked from a mid game
+    // state (ex: a multiple hatchery zerg) instead of the starting state
+    const rapidjson::Value * startStates = (val.HasMember("StartStates") && val["StartStates"].IsObject()) ? &val["StartStates"] : nullptr;
+    const rapidjson::Value * startBuildOrders = (val.HasMember("StartBuildOrders") && val["StartBuildOrders"].IsObject()) ? &val["StartBuildOrders"] : nullptr;
+
+    std::vector<BenchmarkResult> results;
+
+    for (size_t r(0); r < races.Size(); ++r)
+    {
+        BOSS_ASSERT(races[r].IsString(), "Benchmark race must be a string");
+        const std::string raceName = races[r].GetString();
+        const RaceID race = Races::GetRaceID(raceName);
+
+        GameState initialState(race);
+        initialState.setStartingState();
+
+        if (startStates && startStates->HasMember(raceName.c_str()))
+        {
+            BOSS_ASSERT((*startStates)[raceName.c_str()].IsString(), "Benchmark start state must be a string");
+            initialState = BOSSParameters::Instance().GetState((*startStates)[raceName.c_str()].GetString());
+            BOSS_ASSERT(initialState.getRace() == race, "Benchmark %s start state is the wrong race", raceName.c_str());
+        }
+
+        if (startBuildOrders && startBuildOrders->HasMember(raceName.c_str()))
+        {
+            BOSS_ASSERT((*startBuildOrders)[raceName.c_str()].IsString(), "Benchmark start build order must be a string");
+            const BuildOrder & startBuildOrder = BOSSParameters::Instance().GetBuildOrder((*startBuildOrders)[raceName.c_str()].GetString());
+            const bool legal = startBuildOrder.doActions(initialState);
+            BOSS_ASSERT(legal, "Benchmark %s start build order is not legal", raceName.c_str());
+        }
+
+        // every race gets its own generator so adding a race doesn't change the other corpora
+        std::mt19937 rng(seed + (unsigned int)race);
+
+        size_t rejected = 0;
+        for (size_t g(0); g < goalsPerRace; ++g)
+        {
+            GameState state;
+            BuildOrderSearchGoal goal;
+
+            // the naive build order is the upper bound of the DFBB searches, so only keep goals it can solve
+            // rejected goals still consume random numbers so the corpus only depends on the seed
+            while (true)
+            {
+                BOSS_ASSERT(rejected < 100 * goalsPerRace, "Couldn't generate a solvable %s benchmark goal", raceName.c_str());
+
+                state = GetStartState(initialState, startActions, rng);
+                goal = GetRandomGoal(race, rng);
+
+                // the build order searches can't expand so never ask for more resource depots than we have
+                const ActionType & resourceDepot = ActionTypes::GetResourceDepot(race);
+                if (goal.getGoal(resourceDepot) > state.getUnitData().getNumTotal(resourceDepot))
+                {
+                    goal.setGoal(resourceDepot, 0);
+                }
+
+                bool solvable = false;
+                try
+                {
+                    solvable = RunBenchmarkSearch("Naive", state, goal, timeLimitMS).solved;
+                }
+                catch (const BOSSException &)
+                {
+                }
+
+                if (solvable)
+                {
+                    break;
+                }
+
+                rejected++;
+            }
+
+            for (size_t s(0); s < searches.size(); ++s)
+            {
+                BenchmarkResult result;
+                result.search = searches[s];
+
+                // a search which asserts on a goal counts as unsolved rather than ending the benchmark
+                try
+                {
+                    result = RunBenchmarkSearch(searches[s], state, goal, timeLimitMS);
+                }
+                catch (const BOSSException & e)
+                {
+                    std::cout << "ERROR: " << raceName << " goal " << g << " " << searches[s] << " search failed\n" << e.what() << "\n";
+                }
+
+                result.race = raceName;
+                result.goalIndex = g;
+                results.push_back(result);
+            }
+        }
+
+        std::cout << raceName << " corpus: " << goalsPerRace << " goals, " << rejected << " unsolvable goals rejected\n";
+    }
+
+    WriteBenchmarkCSV(outputFile + ".csv", results);
+    WriteBenchmarkJSON(outputFile + ".json", name, seed, results);
+
+    // print each race and search: mean makespan over the solved goals, totals for nodes and time
+    std::cout << "\n" << name << " Benchmark Summary (seed " << seed << ", GameState " << sizeof(GameState) << " bytes)\n\n";
+    std::cout << "       Race      Search  Solved   MeanMakespan      TotalNodes   TotalTimeMS     Nodes/sec\n";
+    for (size_t r(0); r < races.Size(); ++r)
+    {
+        for (size_t s(0); s < searches.size(); ++s)
+        {
+            BenchmarkResult total;
+            size_t numSolved = 0;
+            double makespanSum = 0;
+
+            for (size_t i(0); i < results.size(); ++i)
+            {
+                if (results[i].race == races[r].GetString() && results[i].search == searches[s])
+                {
+                    numSolved += results[i].solved ? 1 : 0;
+                    makespanSum += results[i].solved ? results[i].makespan : 0;
+                    total.nodesExpanded += results[i].nodesExpanded;
+                    total.timeElapsed += results[i].timeElapsed;
+                }
+            }
+
+            const double meanMakespan = numSolved > 0 ? makespanSum / numSolved : 0;
+
+            printf("%11s%12s%5d/%-3d%14.1lf%16llu%14.2lf%14.0lf\n", races[r].GetString(), searches[s].c_str(), (int)numSolved, (int)goalsPerRace, meanMakespan, total.nodesExpanded, total.timeElapsed, total.nodesPerSec());
+        }
+    }
+
+    if (val.HasMember("BaselineFile") && val["BaselineFile"].IsString())
+    {
+        CompareToBaseline(results, ReadBenchmarkCSV(val["BaselineFile"].GetString()));
+    }
+}
+
+// DFBB is the plain depth first branch and bound search on the goal computed by the smart search,
+// with none of the smart search abstractions (repetitions, always make workers, supply bounding)
+BuildOrderTester::BenchmarkResult BuildOrderTester::RunBenchmarkSearch(const std::string & search, const GameState & state, const BuildOrderSearchGoal & goal, const int timeLimitMS)
+{
+    BenchmarkResult result;
+    result.search = search;
+
+    if (search == "Naive")
+    {
+        Timer timer;
+        timer.start();
+
+        NaiveBuildOrderSearch naiveSearch(state, goal);
+        const BuildOrder & buildOrder = naiveSearch.solve();
+
+        result.timeElapsed = timer.getElapsedTimeInMilliSec();
+        result.nodesExpanded = buildOrder.size();
+
+        GameState finalState(state);
+        BuildOrderSearchGoal naiveGoal(goal);
+        if (buildOrder.doActions(finalState) && naiveGoal.isAchievedBy(finalState))
+        {
+            result.solved = true;
+            result.makespan = finalState.getLastActionFinishTime();
+        }
+    }
+    else if (search == "DFBB" || search == "Smart")
+    {
+        DFBB_BuildOrderSmartSearch smartSearch(state.getRace());
+        smartSearch.setGoal(goal);
+        smartSearch.setState(state);
+        smartSearch.setTimeLimit(timeLimitMS);
+
+        DFBB_BuildOrderSearchResults searchResults;
+        if (search == "Smart")
+        {
+            smartSearch.search();
+            searchResults = smartSearch.getResults();
+        }
+        else
+        {
+            DFBB_BuildOrderSearchParameters params(smartSearch.getParameters());
+            params.useRepetitions           = false;
+            params.useIncreasingRepetitions = false;
+            params.useAlwaysMakeWorkers     = false;
+            params.useSupplyBounding        = false;
+            params.searchTimeLimit          = timeLimitMS;
+
+            DFBB_BuildOrderStackSearch stackSearch(params);
+            stackSearch.search();
+            searchResults = stackSearch.getResults();
+        }
+
+        result.solved = searchResults.solved && searchResults.solutionFound;
+        result.makespan = searchResults.solutionFound ? searchResults.upperBound : -1;
+        result.nodesExpanded = searchResults.nodesExpanded;
+        result.timeElapsed = searchResults.timeElapsed;
+    }
+    else
+    {
+        BOSS_ASSERT(false, "Unknown benchmark search type: %s", search.c_str());
+    }
+
+    return result;
+}
+
+void BuildOrderTester::WriteBenchmarkCSV(const std::string & filename, const std::vector<BenchmarkResult> & results)
+{
+    std::ofstream fout(filename.c_str());
+    BOSS_ASSERT(fout.is_open(), "Couldn't open benchmark output file: %s", filename.c_str());
+
+    fout << "Race,Goal,Search,Solved,Makespan,Nodes,TimeMS,NodesPerSec\n";
+    for (size_t i(0); i < results.size(); ++i)
+    {
+        fout << results[i].getCSVString() << "\n";
+    }
+}
+
+void BuildOrderTester::WriteBenchmarkJSON(const std::string & filename, const std::string & name, const unsigned int seed, const std::vector<BenchmarkResult> & results)
+{
+    std::ofstream fout(filename.c_str());
+    BOSS_ASSERT(fout.is_open(), "Couldn't open benchmark output file: %s", filename.c_str());
+
+    fout << "{\n\"Name\" : \"" << name << "\",\n\"Seed\" : " << seed << ",\n\"GameStateBytes\" : " << sizeof(GameState) << ",\n\"Results\" : [\n";
+    for (size_t i(0); i < results.size(); ++i)
+    {
+        fout << "    " << results[i].getJSONString() << (i < results.size() - 1 ? ",\n" : "\n");
+    }
+    fout << "]\n}\n";
+}
+
+std::map<std::string, BuildOrderTester::BenchmarkResult> BuildOrderTester::ReadBenchmarkCSV(const std::string & filename)
+{
+    std::map<std::string, BenchmarkResult> results;
+
+    std::ifstream fin(filename.c_str());
+    if (!fin.is_open())
+    {
+        std::cout << "WARNING: Benchmark baseline file not found: " << filename << "\n";
+        return results;
+    }
+
+    std::string line;
+    std::getline(fin, line); // header
+
+    while (std::getline(fin, line))
+    {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ','))
+        {
+            fields.push_back(field);
+        }
+
+        if (fields.size() < 7)
+        {
+            continue;
+        }
+
+        BenchmarkResult result;
+        result.race          = fields[0];
+        result.goalIndex     = atoi(fields[1].c_str());
+        result.search        = fields[2];
+        result.solved        = atoi(fields[3].c_str()) != 0;
+        result.makespan      = atoi(fields[4].c_str());
+        result.nodesExpanded = strtoull(fields[5].c_str(), NULL, 10);
+        result.timeElapsed   = atof(fields[6].c_str());
+
+        results[result.getKey()] = result;
+    }
+
+    return results;
+}
+
+// compares each result to the baseline result of the same race, goal and search
+// makespans are deterministic for a given corpus, so any change there is reported individually
+void BuildOrderTester::CompareToBaseline(const std::vector<BenchmarkResult> & results, const std::map<std::string, BenchmarkResult> & baseline)
+{
+    if (baseline.empty())
+    {
+        return;
+    }
+
+    std::map<std::string, double> baselineTime, currentTime;
+    std::map<std::string, unsigned long long> baselineNodes, currentNodes;
+    std::map<std::string, int> better, worse;
+    size_t compared = 0;
+
+    std::cout << "\nComparison to baseline\n\n";
+
+    for (size_t i(0); i < results.size(); ++i)
+    {
+        const BenchmarkResult & result = results[i];
+        std::map<std::string, BenchmarkResult>::const_iterator it = baseline.find(result.getKey());
+
+        if (it == baseline.end())
+        {
+            continue;
+        }
+
+        const BenchmarkResult & base = it->second;
+        compared++;
+
+        baselineTime[result.search] += base.timeElapsed;
+        currentTime[result.search] += result.timeElapsed;
+        baselineNodes[result.search] += base.nodesExpanded;
+        currentNodes[result.search] += result.nodesExpanded;
+
+        // an unsolved goal is worse than any solved one
+        const int baseMakespan = base.makespan >= 0 ? base.makespan : std::numeric_limits<int>::max();
+        const int makespan = result.makespan >= 0 ? result.makespan : std::numeric_limits<int>::max();
+
+        if (makespan < baseMakespan)
+        {
+            better[result.search]++;
+        }
+        else if (makespan > baseMakespan)
+        {
+            worse[result.search]++;
+            std::cout << "    REGRESSION " << result.getKey() << " makespan " << base.makespan << " -> " << result.makespan << "\n";
+        }
+    }
+
+    std::cout << "\n    Search    Better     Worse    BaseTimeMS       TimeMS   TimeRatio    BaseNodes/s      Nodes/s\n";
+    for (std::map<std::string, double>::const_iterator it = currentTime.begin(); it != currentTime.end(); ++it)
+    {
+        const std::string & search = it->first;
+        const double baseTime = baselineTime[search];
+        const double time = currentTime[search];
+
+        printf("%10s%10d%10d%14.2lf%13.2lf%12.3lf%15.0lf%13.0lf\n", search.c_str(), better[search], worse[search], baseTime, time, baseTime > 0 ? time / baseTime : 0,
+            baseTime > 0 ? 1000.0 * baselineNodes[search] / baseTime : 0, time > 0 ? 1000.0 * currentNodes[search] / time : 0);
+    }
+
+    std::cout << "\n    Compared " << compared << " of " << results.size() << " results to the baseline\n";
+}
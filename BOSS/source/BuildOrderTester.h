@@ -1,16 +1,51 @@
 #pragma once
 
 #include "BOSS.h"
+#include "JSONTools.h"
+#include "rapidjson/rapidjson.h"
+#include "rapidjson/document.h"
+#include <random>
+#include <map>
 
 namespace BOSS
 {
 
 namespace BuildOrderTester
 {
-    GameState GetStartState(const RaceID race, int randomActions);
-    BuildOrderSearchGoal GetRandomGoal(const RaceID race);
+    // result of a single search on a single goal of the benchmark corpus
+    class BenchmarkResult
+    {
+    public:
+        std::string         race;
+        size_t              goalIndex;
+        std::string         search;
+        bool                solved;
+        int                 makespan;       // frame the last goal action finishes, -1 if no build order was found
+        unsigned long long  nodesExpanded;
+        double              timeElapsed;    // milliseconds
+
+        BenchmarkResult();
+
+        double              nodesPerSec() const;
+        std::string         getKey() const;
+        std::string         getCSVString() const;
+        std::string         getJSONString() const;
+    };
+
+    GameState GetStartState(const RaceID race, int randomActions, std::mt19937 & rng);
+    GameState GetStartState(const GameState & initialState, int randomActions, std::mt19937 & rng);
+    BuildOrderSearchGoal GetRandomGoal(const RaceID race, std::mt19937 & rng);
     void DoRandomTests(const RaceID race, const size_t numTests);
 
     void TestRandomBuilds(const RaceID race, const size_t numTests);
+
+    // benchmark suite, run as a 'BuildOrderBenchmark' experiment
+    void RunBenchmark(const std::string & name, const rapidjson::Value & val);
+    BenchmarkResult RunBenchmarkSearch(const std::string & search, const GameState & state, const BuildOrderSearchGoal & goal, const int timeLimitMS);
+
+    void WriteBenchmarkCSV(const std::string & filename, const std::vector<BenchmarkResult> & results);
+    void WriteBenchmarkJSON(const std::string & filename, const std::string & name, const unsigned int seed, const std::vector<BenchmarkResult> & results);
+    std::map<std::string, BenchmarkResult> ReadBenchmarkCSV(const std::string & filename);
+    void CompareToBaseline(const std::vector<BenchmarkResult> & results, const std::map<std::string, BenchmarkResult> & baseline);
+}
 }
-}
\ No newline at end of file
@@ -4,27 +4,29 @@ using namespace BOSS;
 
 BuildingStatus::BuildingStatus() 
 : _type(ActionTypes::None)
-, _timeRemaining(0) 
 , _isConstructing(ActionTypes::None)
 , _addon(ActionTypes::None)
+, _timeRemaining(0) 
 {
 	
 }
 	
 BuildingStatus::BuildingStatus(const ActionType & action, const ActionType & addon) 
 : _type(action)
-, _timeRemaining(0) 
 , _isConstructing(ActionTypes::None)
 , _addon(addon)
+, _timeRemaining(0) 
 {
 }
 
 BuildingStatus::BuildingStatus(const ActionType & action, FrameCountType time, const ActionType & constructing, const ActionType & addon) 
 : _type(action)
-, _timeRemaining(time) 
 , _isConstructing(constructing)
 , _addon(addon)
+, _timeRemaining(time) 
 {
+    BOSS_ASSERT(time >= 0 && time <= std::numeric_limits<unsigned short>::max(), "Building time remaining out of range: %d", time);
+
 }
 
 const bool BuildingStatus::canBuildEventually(const ActionType & action) const
@@ -136,7 +138,7 @@ BuildingData::BuildingData()
 {
 }
 
-const size_t & BuildingData::size() const
+const size_t BuildingData::size() const
 {
     return _buildings.size();
 }
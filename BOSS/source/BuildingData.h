@@ -5,6 +5,7 @@
 #include <string.h>
 #include <queue>
 #include <algorithm>
+#include <limits>
 
 #include "PrerequisiteSet.h"
 #include "Array.hpp"
@@ -19,9 +20,9 @@ class BuildingStatus
 public:
 
 	ActionType _type;               // the type of building this is
-    FrameCountType _timeRemaining;  // amount of time until the unit is finished constructing
     ActionType _isConstructing;     // the type of unit the building is currently constructing
     ActionType _addon;              // the type of addon that the building currently has (is set once completed)
+    unsigned short _timeRemaining;  // amount of time until the unit is finished constructing, build times fit in 16 bits
 	
 	// the number of frames remaining (from currentFrame) until this building is free
 	
@@ -59,7 +60,7 @@ public:
 	void queueAction(const ActionType & action);
 	void fastForwardBuildings(const FrameCountType frames);
 	void printBuildingInformation() const;
-    const size_t & size() const;
+    const size_t size() const;
 
     const bool canBuildNow(const ActionType & action) const;
     const bool canBuildEventually(const ActionType & action) const;
@@ -13,6 +13,11 @@ void CombatSearch::search()
     _buildOrder = _params.getOpeningBuildOrder();
     _buildOrder.doActions(initialState);
 
+    if (_params.getDominancePruning())
+    {
+        _dominance = CombatSearch_DominanceData(_params.getFrameTimeLimit(), _params.getDominanceBucketFrames(), _params.getDominanceBucketSize());
+    }
+
     try
     {
         recurse(initialState, 0);
@@ -28,6 +33,9 @@ void CombatSearch::search()
     }
 
     _results.timeElapsed = _searchTimer.getElapsedTimeInMilliSec();
+    _results.dominanceLookups = _dominance.getLookups();
+    _results.dominanceHits = _dominance.getHits();
+    _results.dominanceArchiveSize = _dominance.getNumStates();
 }
 
 // This functio generates the legal actions from a GameState based on the input search parameters
@@ -107,6 +115,26 @@ bool CombatSearch::timeLimitReached()
     return (_params.getSearchTimeLimit() && (_results.nodesExpanded % 100 == 0) && (_searchTimer.getElapsedTimeInMilliSec() > _params.getSearchTimeLimit()));
 }
 
+// returns true if the state should not be expanded because a previously expanded state dominates it
+// value is whatever the search accumulated up to this state's frame which the dominating state must also match
+// rate is how much value the state accumulates per frame from then on
+bool CombatSearch::isDominated(const GameState & state, const double value, const double rate)
+{
+    if (!_params.getDominancePruning())
+    {
+        return false;
+    }
+
+    if (_dominance.isDominated(state, value))
+    {
+        _results.nodesPruned++;
+        return true;
+    }
+
+    _dominance.add(state, value, rate);
+    return false;
+}
+
 bool CombatSearch::isTerminalNode(const GameState & s, int depth)
 {
     if (s.getCurrentFrame() >= _params.getFrameTimeLimit())
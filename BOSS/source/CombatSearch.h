@@ -6,6 +6,7 @@
 #include "BuildOrder.h"
 #include "CombatSearchParameters.h"
 #include "CombatSearchResults.h"
+#include "CombatSearch_DominanceData.h"
 
 namespace BOSS
 {
@@ -26,6 +27,8 @@ protected:
 
     BuildOrder                  _buildOrder;
 
+    CombatSearch_DominanceData  _dominance;         // archive of nondominated states used for dominance pruning
+
     virtual void                recurse(const GameState & s,size_t depth);
     virtual void                generateLegalActions(const GameState & state,ActionSet & legalActions,const CombatSearchParameters & params);
 
@@ -34,6 +37,7 @@ protected:
 
     virtual void                updateResults(const GameState & state);
     virtual bool                timeLimitReached();
+    virtual bool                isDominated(const GameState & state, const double value = 0, const double rate = 0);
 
 public:
 
@@ -5,6 +5,7 @@ using namespace BOSS;
 
 CombatSearchExperiment::CombatSearchExperiment()
     : _race(Races::None)
+    , _compareUnpruned(false)
 {
 
 }
@@ -12,6 +13,7 @@ CombatSearchExperiment::CombatSearchExperiment()
 CombatSearchExperiment::CombatSearchExperiment(const std::string & name, const rapidjson::Value & val)
     : _race(Races::None)
     , _name(name)
+    , _compareUnpruned(false)
 {
     BOSS_ASSERT(val.HasMember("SearchTypes") && val["SearchTypes"].IsArray(), "CombatSearchExperiment must have a 'SearchTypes' array");
     for (size_t i(0); i < val["SearchTypes"].Size(); ++i)
@@ -75,6 +77,30 @@ CombatSearchExperiment::CombatSearchExperiment(const std::string & name, const r
         _params.setAlwaysMakeWorkers(val["AlwaysMakeWorkers"].GetBool());
     }
 
+    if (val.HasMember("DominancePruning"))
+    {
+        BOSS_ASSERT(val["DominancePruning"].IsBool(), "DominancePruning should be a bool");
+        _params.setDominancePruning(val["DominancePruning"].GetBool());
+    }
+
+    if (val.HasMember("DominanceBucketFrames"))
+    {
+        BOSS_ASSERT(val["DominanceBucketFrames"].IsInt() && val["DominanceBucketFrames"].GetInt() > 0, "DominanceBucketFrames should be a positive int");
+        _params.setDominanceBucketFrames(val["DominanceBucketFrames"].GetInt());
+    }
+
+    if (val.HasMember("DominanceBucketSize"))
+    {
+        BOSS_ASSERT(val["DominanceBucketSize"].IsInt() && val["DominanceBucketSize"].GetInt() >= 0, "DominanceBucketSize should be a non-negative int");
+        _params.setDominanceBucketSize(val["DominanceBucketSize"].GetInt());
+    }
+
+    if (val.HasMember("CompareUnpruned"))
+    {
+        BOSS_ASSERT(val["CompareUnpruned"].IsBool(), "CompareUnpruned should be a bool");
+        _compareUnpruned = val["CompareUnpruned"].GetBool();
+    }
+
     if (val.HasMember("OpeningBuildOrder"))
     {
         BOSS_ASSERT(val["OpeningBuildOrder"].IsString(), "OpeningBuildOrder should be a string");
@@ -95,42 +121,133 @@ CombatSearchExperiment::CombatSearchExperiment(const std::string & name, const r
         BOSS_ASSERT(brVal.HasMember("EnemyBuildOrder") && brVal["EnemyBuildOrder"].IsString(), "BestResponseParams must have a 'EnemyBuildOrder' string");
         _params.setEnemyBuildOrder(BOSSParameters::Instance().GetBuildOrder(brVal["EnemyBuildOrder"].GetString()));
     }
-}
 
-void CombatSearchExperiment::run()
-{
-    static std::string stars = "************************************************";
-    for (size_t i(0); i < _searchTypes.size(); ++i)
+    if (val.HasMember("MCTSParams"))
     {
-        std::shared_ptr<CombatSearch> combatSearch;
-        std::string resultsFile = "gnuplot/" + _name;
+        const rapidjson::Value & mctsVal = val["MCTSParams"];
 
-        std::cout << "\n" << stars << "\n* Running Experiment: " << _name << " [" << _searchTypes[i] << "]\n" << stars << "\n";
+        BOSS_ASSERT(mctsVal.IsObject(), "MCTSParams not an object");
 
-        if (_searchTypes[i].compare("Integral") == 0)
+        if (mctsVal.HasMember("Threads"))
         {
-            combatSearch = std::shared_ptr<CombatSearch>(new CombatSearch_Integral(_params));
-            resultsFile += "_Integral"; 
+            BOSS_ASSERT(mctsVal["Threads"].IsInt() && mctsVal["Threads"].GetInt() > 0, "MCTSParams 'Threads' should be a positive int");
+            _params.setMCTSThreads(mctsVal["Threads"].GetInt());
         }
-        else if (_searchTypes[i].compare("Bucket") == 0)
+
+        if (mctsVal.HasMember("Exploration"))
         {
-            combatSearch = std::shared_ptr<CombatSearch>(new CombatSearch_Bucket(_params));
-            resultsFile += "_Bucket"; 
+            BOSS_ASSERT(mctsVal["Exploration"].IsNumber(), "MCTSParams 'Exploration' should be a number");
+            _params.setMCTSExploration(mctsVal["Exploration"].GetDouble());
         }
-        else if (_searchTypes[i].compare("BestResponse") == 0)
+
+        if (mctsVal.HasMember("ArmyBias"))
         {
-            combatSearch = std::shared_ptr<CombatSearch>(new CombatSearch_BestResponse(_params));
-            resultsFile += "_BestResponse"; 
+            BOSS_ASSERT(mctsVal["ArmyBias"].IsNumber() && mctsVal["ArmyBias"].GetDouble() >= 0 && mctsVal["ArmyBias"].GetDouble() <= 1, "MCTSParams 'ArmyBias' should be a number between 0 and 1");
+            _params.setMCTSArmyBias(mctsVal["ArmyBias"].GetDouble());
         }
-        else
+
+        if (mctsVal.HasMember("IterationLimit"))
         {
-            BOSS_ASSERT(false, "CombatSearch type not found: %s", _searchTypes[i].c_str());
+            BOSS_ASSERT(mctsVal["IterationLimit"].IsInt() && mctsVal["IterationLimit"].GetInt() >= 0, "MCTSParams 'IterationLimit' should be a non-negative int");
+            _params.setMCTSIterationLimit(mctsVal["IterationLimit"].GetInt());
         }
 
+        if (mctsVal.HasMember("RandomSeed"))
+        {
+            BOSS_ASSERT(mctsVal["RandomSeed"].IsInt(), "MCTSParams 'RandomSeed' should be an int");
+            _params.setRandomSeed(mctsVal["RandomSeed"].GetInt());
+        }
+    }
+}
+
+std::shared_ptr<CombatSearch> CombatSearchExperiment::createSearch(const std::string & searchType, const CombatSearchParameters & params) const
+{
+    if (searchType.compare("Integral") == 0)
+    {
+        return std::shared_ptr<CombatSearch>(new CombatSearch_Integral(params));
+    }
+    else if (searchType.compare("Bucket") == 0)
+    {
+        return std::shared_ptr<CombatSearch>(new CombatSearch_Bucket(params));
+    }
+    else if (searchType.compare("BestResponse") == 0)
+    {
+        return std::shared_ptr<CombatSearch>(new CombatSearch_BestResponse(params));
+    }
+    else if (searchType.compare("MCTS") == 0)
+    {
+        return std::shared_ptr<CombatSearch>(new CombatSearch_MCTS(params));
+    }
+
+    BOSS_ASSERT(false, "CombatSearch type not found: %s", searchType.c_str());
+    return std::shared_ptr<CombatSearch>();
+}
+
+// dominance pruning is a heuristic, so rerun the search without it and report whether the result changed
+// only meaningful when both searches run to completion rather than stopping at the time limit
+void CombatSearchExperiment::compareUnpruned(const std::string & searchType, const CombatSearchResults & prunedResults) const
+{
+    CombatSearchParameters unprunedParams(_params);
+    unprunedParams.setDominancePruning(false);
+
+    std::shared_ptr<CombatSearch> unprunedSearch = createSearch(searchType, unprunedParams);
+    unprunedSearch->search();
+    const CombatSearchResults & results = unprunedSearch->getResults();
+
+    std::cout << "Unpruned search: " << results.nodesExpanded << " nodes in " << results.timeElapsed << "ms, ArmyIntegral " << (results.highestEval/Constants::RESOURCE_SCALE) << "\n";
+
+    if (!prunedResults.solved || !results.solved)
+    {
+        std::cout << "Dominance pruning comparison skipped: a search timed out\n\n";
+    }
+    else if (results.highestEval != prunedResults.highestEval)
+    {
+        std::cout << "Dominance pruning MISMATCH: pruned " << (prunedResults.highestEval/Constants::RESOURCE_SCALE) << " vs unpruned " << (results.highestEval/Constants::RESOURCE_SCALE) << "\n\n";
+    }
+    else
+    {
+        std::cout << "Dominance pruning matches unpruned search\n\n";
+    }
+}
+
+void CombatSearchExperiment::run()
+{
+    static std::string stars = "************************************************";
+    std::stringstream summary;
+
+    for (size_t i(0); i < _searchTypes.size(); ++i)
+    {
+        std::string resultsFile = "gnuplot/" + _name + "_" + _searchTypes[i];
+
+        std::cout << "\n" << stars << "\n* Running Experiment: " << _name << " [" << _searchTypes[i] << "]\n" << stars << "\n";
+
+        std::shared_ptr<CombatSearch> combatSearch = createSearch(_searchTypes[i], _params);
         combatSearch->search();
         combatSearch->printResults();
         combatSearch->writeResultsFile(resultsFile);
         const CombatSearchResults & results = combatSearch->getResults();
         std::cout << "\nSearched " << results.nodesExpanded << " nodes in " << results.timeElapsed << "ms @ " << (1000.0*results.nodesExpanded/results.timeElapsed) << " nodes/sec\n\n";
+
+        if (results.dominanceLookups > 0)
+        {
+            std::cout << "Dominance pruned " << results.nodesPruned << " nodes, archive hit rate " << (100.0*results.dominanceHitRate()) << "% of " << results.dominanceLookups << " lookups, " << results.dominanceArchiveSize << " states archived\n\n";
+        }
+
+        if (_compareUnpruned && _params.getDominancePruning())
+        {
+            compareUnpruned(_searchTypes[i], results);
+        }
+
+        char line[256];
+        sprintf(line, "%14s%14llu%14llu%10.2lf%12.2lf%14.0lf%16.2lf\n", _searchTypes[i].c_str(), results.nodesExpanded, results.nodesPruned, 100.0*results.dominanceHitRate(), results.timeElapsed, (1000.0*results.nodesExpanded/results.timeElapsed), results.highestEval/Constants::RESOURCE_SCALE);
+        summary << line;
+    }
+
+    // print the search types side by side so their army integrals can be compared for the same time budget
+    if (_searchTypes.size() > 1)
+    {
+        std::cout << "\nExperiment Summary: " << _name << "\n\n";
+        std::cout << "    SearchType         Nodes        Pruned  DomHit%      TimeMS     Nodes/sec    ArmyIntegral\n";
+        std::cout << summary.str() << "\n";
     }
 }
\ No newline at end of file
@@ -19,6 +19,11 @@ class CombatSearchExperiment
     RaceID                      _enemyRace;
     BuildOrder                  _enemyBuildOrder;
 
+    bool                        _compareUnpruned;   // rerun dominance pruned searches without pruning and report differences
+
+    std::shared_ptr<CombatSearch> createSearch(const std::string & searchType, const CombatSearchParameters & params) const;
+    void compareUnpruned(const std::string & searchType, const CombatSearchResults & prunedResults) const;
+
 public:
 
     CombatSearchExperiment();
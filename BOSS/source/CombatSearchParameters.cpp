@@ -13,6 +13,9 @@ CombatSearchParameters::CombatSearchParameters()
     , _supplyBoundingThreshold       (1)
     , _useLandmarkLowerBoundHeuristic(false)
     , _useResourceLowerBoundHeuristic(false)
+    , _useDominancePruning           (false)
+    , _dominanceBucketFrames         (48)
+    , _dominanceBucketSize           (32)
     , _searchTimeLimit               (0)
     , _initialUpperBound             (0)
     , _initialState                  (Races::None)
@@ -20,6 +23,11 @@ CombatSearchParameters::CombatSearchParameters()
     , _repetitionValues              (Constants::MAX_ACTIONS, 1)
     , _repetitionThresholds          (Constants::MAX_ACTIONS, 0)
     , _printNewBest                  (false)
+    , _mctsThreads                   (1)
+    , _mctsExploration               (1.0)
+    , _mctsArmyBias                  (0.5)
+    , _mctsIterationLimit            (0)
+    , _randomSeed                    (0)
 {
     
 }
@@ -124,6 +132,86 @@ FrameCountType CombatSearchParameters::getFrameTimeLimit() const
     return _frameTimeLimit;
 }
 
+void CombatSearchParameters::setDominancePruning(const bool flag)
+{
+    _useDominancePruning = flag;
+}
+
+const bool CombatSearchParameters::getDominancePruning() const
+{
+    return _useDominancePruning;
+}
+
+void CombatSearchParameters::setDominanceBucketFrames(const int frames)
+{
+    _dominanceBucketFrames = frames;
+}
+
+int CombatSearchParameters::getDominanceBucketFrames() const
+{
+    return _dominanceBucketFrames;
+}
+
+void CombatSearchParameters::setDominanceBucketSize(const size_t size)
+{
+    _dominanceBucketSize = size;
+}
+
+size_t CombatSearchParameters::getDominanceBucketSize() const
+{
+    return _dominanceBucketSize;
+}
+
+void CombatSearchParameters::setMCTSThreads(const size_t threads)
+{
+    _mctsThreads = threads;
+}
+
+size_t CombatSearchParameters::getMCTSThreads() const
+{
+    return _mctsThreads;
+}
+
+void CombatSearchParameters::setMCTSExploration(const double exploration)
+{
+    _mctsExploration = exploration;
+}
+
+double CombatSearchParameters::getMCTSExploration() const
+{
+    return _mctsExploration;
+}
+
+void CombatSearchParameters::setMCTSArmyBias(const double bias)
+{
+    _mctsArmyBias = bias;
+}
+
+double CombatSearchParameters::getMCTSArmyBias() const
+{
+    return _mctsArmyBias;
+}
+
+void CombatSearchParameters::setMCTSIterationLimit(const size_t iterations)
+{
+    _mctsIterationLimit = iterations;
+}
+
+size_t CombatSearchParameters::getMCTSIterationLimit() const
+{
+    return _mctsIterationLimit;
+}
+
+void CombatSearchParameters::setRandomSeed(const unsigned int seed)
+{
+    _randomSeed = seed;
+}
+
+unsigned int CombatSearchParameters::getRandomSeed() const
+{
+    return _randomSeed;
+}
+
 
 
 void CombatSearchParameters::print()
@@ -137,6 +225,7 @@ void CombatSearchParameters::print()
     printf("%s", _useResourceLowerBoundHeuristic ?    "\tUSE      Resource Lower Bound\n" : "");
     printf("%s", _useAlwaysMakeWorkers ?              "\tUSE      Always Make Workers\n" : "");
     printf("%s", _useSupplyBounding ?                 "\tUSE      Supply Bounding\n" : "");
+    printf("%s", _useDominancePruning ?               "\tUSE      Dominance Pruning\n" : "");
     printf("\n");
 
     //for (int a = 0; a < ACTIONS.size(); ++a)
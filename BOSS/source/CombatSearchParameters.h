@@ -77,6 +77,24 @@ class CombatSearchParameters
 	//      false: the heuristic is not used
 	bool	_useLandmarkLowerBoundHeuristic;
 	bool	_useResourceLowerBoundHeuristic;
+
+	//      Flag which determines whether or not we use dominance pruning in combat search
+	//      Every expanded state is stored in an archive bucketed by frame. A state is not expanded
+	//          if an archived state in its bucket was reached no later, can match its resources,
+	//          units, production and in-progress finish times (Eval::StateDominatesInTime) and has
+	//          at least as high a search value by the state's frame.
+	//          Each bucket spans dominanceBucketFrames frames and holds at most dominanceBucketSize
+	//          states, so checking a state costs a bounded number of comparisons.
+	//          This is a heuristic, not exact: it can miss the best solution. It is also no faster:
+	//          on the Protoss start state to 4000 frames it prunes at most about 7% of lookups and
+	//          cuts nodes by 20-27%, but the archive costs more time than that saves. So it is off by default.
+	//          Experiments can set CompareUnpruned to rerun the search without it and report differences.
+	//
+	//      true:  dominance pruning is used
+	//      false: dominance pruning is not used (default)
+	bool	_useDominancePruning;
+	int		_dominanceBucketFrames;
+	size_t	_dominanceBucketSize;
 	
 	//      Search time limit measured in milliseconds
 	//      If searchTimeLimit is set to a value greater than zero, the search will effectively
@@ -102,6 +120,18 @@ class CombatSearchParameters
     FrameCountType          _frameTimeLimit;
     bool                    _printNewBest;
 
+    //      Parameters used only by the Monte Carlo tree search (CombatSearch_MCTS)
+    //      mctsThreads:        number of independent trees searched in parallel (root parallelism)
+    //      mctsExploration:    UCT exploration constant, applied to values normalized to [0,1]
+    //      mctsArmyBias:       chance that a playout step picks an army unit when one is legal, otherwise any legal action
+    //      mctsIterationLimit: maximum number of playouts per tree, 0 means limited only by time
+    //      randomSeed:         seed for the playout random number generators, tree i uses seed+i
+    size_t                  _mctsThreads;
+    double                  _mctsExploration;
+    double                  _mctsArmyBias;
+    size_t                  _mctsIterationLimit;
+    unsigned int            _randomSeed;
+
 
 
 public:
@@ -138,6 +168,30 @@ public:
 
     void                setAlwaysMakeWorkers(const bool flag);
     const bool          getAlwaysMakeWorkers() const;
+
+    void                setDominancePruning(const bool flag);
+    const bool          getDominancePruning() const;
+
+    void                setDominanceBucketFrames(const int frames);
+    int                 getDominanceBucketFrames() const;
+
+    void                setDominanceBucketSize(const size_t size);
+    size_t              getDominanceBucketSize() const;
+
+    void                setMCTSThreads(const size_t threads);
+    size_t              getMCTSThreads() const;
+
+    void                setMCTSExploration(const double exploration);
+    double              getMCTSExploration() const;
+
+    void                setMCTSArmyBias(const double bias);
+    double              getMCTSArmyBias() const;
+
+    void                setMCTSIterationLimit(const size_t iterations);
+    size_t              getMCTSIterationLimit() const;
+
+    void                setRandomSeed(const unsigned int seed);
+    unsigned int        getRandomSeed() const;
 	
 	void print();
 };
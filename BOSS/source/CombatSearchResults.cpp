@@ -9,6 +9,10 @@ CombatSearchResults::CombatSearchResults()
     , upperBound(-1)
     , lowerBound(-1)
     , nodesExpanded(0)
+    , nodesPruned(0)
+    , dominanceLookups(0)
+    , dominanceHits(0)
+    , dominanceArchiveSize(0)
     , timeElapsed(0)
     , avgBranch(0)
     , minerals(0)
@@ -31,6 +35,11 @@ void CombatSearchResults::printResults(bool pbo)
     printf("\n");
 }
 
+double CombatSearchResults::dominanceHitRate() const
+{
+    return dominanceLookups > 0 ? ((double)dominanceHits / dominanceLookups) : 0;
+}
+
 void CombatSearchResults::printBuildOrder()
 {
     for (size_t i(0); i<buildOrder.size(); ++i)
@@ -21,6 +21,11 @@ public:
     int                 lowerBound;		// lower bound of first node
 
     unsigned long long  nodesExpanded;	// number of nodes expanded in the search
+    unsigned long long  nodesPruned;	// number of nodes not expanded because an archived state dominated them
+
+    unsigned long long  dominanceLookups;   // number of states checked against the dominance archive
+    unsigned long long  dominanceHits;      // number of those states which were dominated
+    size_t              dominanceArchiveSize;
 
     double              timeElapsed;	// time elapsed in milliseconds
     double              avgBranch;		// avg branching factor
@@ -41,6 +46,8 @@ public:
     CombatSearchResults();
     CombatSearchResults(bool s,int len,unsigned long long n,double t,std::vector<ActionType> solution);
 
+    double dominanceHitRate() const;
+
     void printResults(bool pbo = true);
     void printBuildOrder();
 };
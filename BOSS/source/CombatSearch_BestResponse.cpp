@@ -25,6 +25,11 @@ void CombatSearch_BestResponse::recurse(const GameState & state, size_t depth)
         return;
     }
 
+    if (isDominated(state))
+    {
+        return;
+    }
+
     ActionSet legalActions;
     generateLegalActions(state, legalActions, _params);
     
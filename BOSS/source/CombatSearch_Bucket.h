@@ -16,7 +16,7 @@ class CombatSearch_Bucket : public CombatSearch
 {
     CombatSearch_BucketData     _bucket;
 
-	virtual void                doSearch(const GameState & s, size_t depth);
+	virtual void                recurse(const GameState & s, size_t depth);
 
 public:
 	
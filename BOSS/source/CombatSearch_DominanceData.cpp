@@ -0,0 +1,115 @@
+#include "CombatSearch_DominanceData.h"
+
+using namespace BOSS;
+
+CombatSearch_DominanceData::CombatSearch_DominanceData()
+    : _bucketFrames(1)
+    , _bucketSize(0)
+    , _lookups(0)
+    , _hits(0)
+{
+
+}
+
+CombatSearch_DominanceData::CombatSearch_DominanceData(const FrameCountType frameLimit, const FrameCountType bucketFrames, const size_t bucketSize)
+    : _buckets((frameLimit / bucketFrames) + 1)
+    , _nextReplace((frameLimit / bucketFrames) + 1, 0)
+    , _bucketFrames(bucketFrames)
+    , _bucketSize(bucketSize)
+    , _lookups(0)
+    , _hits(0)
+{
+    BOSS_ASSERT(bucketFrames > 0, "Dominance bucket must span at least one frame");
+}
+
+const size_t CombatSearch_DominanceData::getBucketIndex(const GameState & state) const
+{
+    // states past the frame limit all share the last bucket
+    return std::min((size_t)(state.getCurrentFrame() / _bucketFrames), _buckets.size() - 1);
+}
+
+bool CombatSearch_DominanceData::isDominated(const GameState & state, const double value)
+{
+    if (_buckets.empty())
+    {
+        return false;
+    }
+
+    _lookups++;
+
+    DominanceEntry::GetUnitCounts(state, _counts);
+    const std::vector<DominanceEntry> & bucket = _buckets[getBucketIndex(state)];
+    for (size_t i(0); i < bucket.size(); ++i)
+    {
+        const DominanceEntry & entry = bucket[i];
+
+        if (entry.mayDominate(state, _counts) && (entry.getValueAt(state.getCurrentFrame()) >= value) && Eval::StateDominatesInTime(entry.state, state))
+        {
+            _hits++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CombatSearch_DominanceData::add(const GameState & state, const double value, const double rate)
+{
+    if (_buckets.empty() || _bucketSize == 0)
+    {
+        return;
+    }
+
+    const size_t bucketIndex = getBucketIndex(state);
+    std::vector<DominanceEntry> & bucket = _buckets[bucketIndex];
+
+    const DominanceEntry newEntry(state, value, rate);
+
+    // remove any archived states which the new state dominates, keeping the archive nondominated
+    for (size_t i(0); i < bucket.size(); )
+    {
+        const FrameCountType frame = bucket[i].state.getCurrentFrame();
+
+        if (newEntry.mayDominate(bucket[i].state, bucket[i].unitCounts) && (newEntry.getValueAt(frame) >= bucket[i].value) && Eval::StateDominatesInTime(state, bucket[i].state))
+        {
+            std::swap(bucket[i], bucket.back());
+            bucket.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    if (bucket.size() < _bucketSize)
+    {
+        bucket.push_back(newEntry);
+    }
+    else
+    {
+        size_t & replace = _nextReplace[bucketIndex];
+        bucket[replace] = newEntry;
+        replace = (replace + 1) % _bucketSize;
+    }
+}
+
+const unsigned long long CombatSearch_DominanceData::getLookups() const
+{
+    return _lookups;
+}
+
+const unsigned long long CombatSearch_DominanceData::getHits() const
+{
+    return _hits;
+}
+
+const size_t CombatSearch_DominanceData::getNumStates() const
+{
+    size_t numStates = 0;
+    for (size_t b(0); b < _buckets.size(); ++b)
+    {
+        numStates += _buckets[b].size();
+    }
+
+    return numStates;
+}
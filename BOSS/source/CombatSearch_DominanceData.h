@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Common.h"
+#include "GameState.h"
+#include "Eval.h"
+
+namespace BOSS
+{
+
+class DominanceEntry
+{
+public:
+    GameState           state;
+    double              value;      // search specific value accumulated up to this state's frame (ex: army integral)
+    double              rate;       // value accumulated per frame after this state (ex: army value)
+    std::vector<UnitCountType>  unitCounts;     // total then completed count of each action type, see GetUnitCounts
+
+    DominanceEntry()
+        : value(0)
+        , rate(0)
+    {
+    }
+
+    DominanceEntry(const GameState & s, const double v, const double r)
+        : state(s)
+        , value(v)
+        , rate(r)
+    {
+        GetUnitCounts(s, unitCounts);
+    }
+
+    // the unit counts StateDominates compares, copied out once so each comparison is a plain array scan
+    static void GetUnitCounts(const GameState & s, std::vector<UnitCountType> & counts)
+    {
+        const size_t numActions = ActionTypes::GetAllActionTypes(s.getRace()).size();
+        counts.resize(2 * numActions);
+        for (size_t a(0); a < numActions; ++a)
+        {
+            const ActionType & action = ActionTypes::GetActionType(s.getRace(), a);
+            counts[a] = s.getUnitData().getNumTotal(action);
+            counts[numActions + a] = s.getUnitData().getNumCompleted(action);
+        }
+    }
+
+    // cheap necessary conditions for this entry's state to dominate the other in time
+    const bool mayDominate(const GameState & other, const std::vector<UnitCountType> & otherCounts) const
+    {
+        if ((state.getCurrentFrame() > other.getCurrentFrame())
+            || (state.getRace() != other.getRace())
+            || (state.getMinerals() < other.getMinerals())
+            || (state.getGas() < other.getGas()))
+        {
+            return false;
+        }
+
+        for (size_t i(0); i < unitCounts.size(); ++i)
+        {
+            if (unitCounts[i] < otherCounts[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // value accumulated up to the given frame, which is no earlier than this state's
+    const double getValueAt(const FrameCountType frame) const
+    {
+        return value + rate * (frame - state.getCurrentFrame());
+    }
+};
+
+// Bounded archive of Pareto-nondominated states, bucketed by frame
+// A state is dominated if a state in its frame bucket was reached no later, can match all of its
+// resources, units, production and in-progress finish times (Eval::StateDominatesInTime) and has
+// accumulated at least as high a value by the dominated state's frame.
+// Each bucket holds at most bucketSize states so a lookup costs a constant number of comparisons.
+// This is a heuristic and not exact: the search may still lose its best solution when pruning,
+// for example when a move limit (MaxActions) stops the dominating state repeating a build order.
+class CombatSearch_DominanceData
+{
+    std::vector< std::vector<DominanceEntry> >  _buckets;
+    std::vector<size_t>                         _nextReplace;   // ring index used to evict entries from full buckets
+    FrameCountType                              _bucketFrames;
+    size_t                                      _bucketSize;
+
+    std::vector<UnitCountType>                  _counts;        // scratch unit counts of the state being looked up
+
+    unsigned long long                          _lookups;
+    unsigned long long                          _hits;
+
+    const size_t getBucketIndex(const GameState & state) const;
+
+public:
+
+    CombatSearch_DominanceData();
+    CombatSearch_DominanceData(const FrameCountType frameLimit, const FrameCountType bucketFrames, const size_t bucketSize);
+
+    bool isDominated(const GameState & state, const double value);
+    void add(const GameState & state, const double value, const double rate);
+
+    const unsigned long long getLookups() const;
+    const unsigned long long getHits() const;
+    const size_t getNumStates() const;
+};
+
+}
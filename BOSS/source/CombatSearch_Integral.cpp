@@ -9,7 +9,7 @@ CombatSearch_Integral::CombatSearch_Integral(const CombatSearchParameters p)
     BOSS_ASSERT(_params.getInitialState().getRace() != Races::None, "Combat search initial state is invalid");
 }
 
-void CombatSearch_Integral::doSearch(const GameState & state, size_t depth)
+void CombatSearch_Integral::recurse(const GameState & state, size_t depth)
 {
     if (timeLimitReached())
     {
@@ -23,6 +23,12 @@ void CombatSearch_Integral::doSearch(const GameState & state, size_t depth)
         return;
     }
 
+    // a dominating state must also have accumulated at least as much army integral by this state's frame
+    if (isDominated(state, _integral.getIntegralValueAt(state.getCurrentFrame()), Eval::ArmyTotalResourceSum(state)))
+    {
+        return;
+    }
+
     ActionSet legalActions;
     generateLegalActions(state, legalActions, _params);
     
@@ -34,8 +40,9 @@ void CombatSearch_Integral::doSearch(const GameState & state, size_t depth)
         child.doAction(legalActions[index]);
         _buildOrder.add(legalActions[index]);
         _integral.update(state, _buildOrder);
+        _results.highestEval = _integral.getBestIntegralValue();
         
-        doSearch(child,depth+1);
+        recurse(child,depth+1);
 
         _buildOrder.pop_back();
         _integral.pop();
@@ -16,7 +16,7 @@ class CombatSearch_Integral : public CombatSearch
 {
     CombatSearch_IntegralData   _integral;
 
-	virtual void                doSearch(const GameState & s, size_t depth);
+	virtual void                recurse(const GameState & s, size_t depth);
 
 public:
 	
@@ -56,4 +56,20 @@ void CombatSearch_IntegralData::print() const
 const BuildOrder & CombatSearch_IntegralData::getBestBuildOrder() const
 {
     return _bestIntegralBuildOrder;
+}
+
+double CombatSearch_IntegralData::getBestIntegralValue() const
+{
+    return _bestIntegralValue;
+}
+
+double CombatSearch_IntegralData::getCurrentIntegralValue() const
+{
+    return _integralStack.back().integral;
+}
+
+// the current integral carried forward to the given frame, which is no earlier than the last update
+double CombatSearch_IntegralData::getIntegralValueAt(const FrameCountType frame) const
+{
+    return _integralStack.back().integral + _integralStack.back().eval * (frame - _integralStack.back().timeAdded);
 }
\ No newline at end of file
@@ -51,6 +51,9 @@ public:
     void print() const;
 
     const BuildOrder & getBestBuildOrder() const;
+    double getBestIntegralValue() const;
+    double getCurrentIntegralValue() const;
+    double getIntegralValueAt(const FrameCountType frame) const;
 };
 
 }
@@ -0,0 +1,215 @@
+#include "CombatSearch_MCTS.h"
+#include <thread>
+
+using namespace BOSS;
+
+CombatSearch_MCTS::CombatSearch_MCTS(const CombatSearchParameters p)
+{
+    _params = p;
+
+    BOSS_ASSERT(_params.getInitialState().getRace() != Races::None, "Combat search initial state is invalid");
+    BOSS_ASSERT(_params.getSearchTimeLimit() > 0 || _params.getMCTSIterationLimit() > 0, "MCTS combat search needs a search time limit or an iteration limit");
+    BOSS_ASSERT(_params.getMCTSThreads() > 0, "MCTS combat search needs at least one thread");
+
+    for (size_t t(0); t < _params.getMCTSThreads(); ++t)
+    {
+        _trees.push_back(CombatSearch_MCTSData(_params.getMCTSExploration(), _params.getRandomSeed() + (unsigned int)t));
+    }
+}
+
+// MCTS does not recurse, this is called once by CombatSearch::search() with the state after the opening build order
+void CombatSearch_MCTS::recurse(const GameState & state, size_t /* depth */)
+{
+    // with root parallelism each tree is searched independently from the same root on its own thread
+    if (_trees.size() == 1)
+    {
+        searchTree(state, _trees[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for (size_t t(0); t < _trees.size(); ++t)
+        {
+            threads.push_back(std::thread(&CombatSearch_MCTS::searchTree, this, std::cref(state), std::ref(_trees[t])));
+        }
+
+        for (size_t t(0); t < threads.size(); ++t)
+        {
+            threads[t].join();
+        }
+    }
+
+    // pick the best playout found by any of the trees
+    size_t bestTree = 0;
+    for (size_t t(0); t < _trees.size(); ++t)
+    {
+        _results.nodesExpanded += _trees[t].getNodesExpanded();
+
+        if (_trees[t].getBestValue() > _trees[bestTree].getBestValue())
+        {
+            bestTree = t;
+        }
+    }
+
+    // replay the best build order through the integral data so the results match CombatSearch_Integral
+    const BuildOrder & bestBuildOrder = _trees[bestTree].getBestBuildOrder();
+    GameState current(state);
+    for (size_t a(_buildOrder.size()); a < bestBuildOrder.size(); ++a)
+    {
+        GameState child(current);
+        child.doAction(bestBuildOrder[a]);
+        _buildOrder.add(bestBuildOrder[a]);
+        _integral.update(current, _buildOrder);
+
+        current = child;
+    }
+
+    _results.highestEval = _integral.getBestIntegralValue();
+
+    // the playouts score build orders the way CombatSearch_IntegralData does, so the replay must agree
+    BOSS_ASSERT(_integral.getBestIntegralValue() == _trees[bestTree].getBestValue(), "MCTS playout value does not match the replayed integral");
+
+    if (_params.getSearchTimeLimit() && (_searchTimer.getElapsedTimeInMilliSec() > _params.getSearchTimeLimit()))
+    {
+        throw BOSS_COMBATSEARCH_TIMEOUT;
+    }
+}
+
+void CombatSearch_MCTS::searchTree(const GameState & root, CombatSearch_MCTSData & tree)
+{
+    // each thread keeps its own timer since Timer is not safe to share
+    Timer timer;
+    timer.start();
+
+    while (!iterationLimitReached(tree, timer))
+    {
+        playout(root, tree);
+    }
+}
+
+bool CombatSearch_MCTS::iterationLimitReached(const CombatSearch_MCTSData & tree, Timer & timer) const
+{
+    if (_params.getMCTSIterationLimit() && (tree.getIterations() >= _params.getMCTSIterationLimit()))
+    {
+        return true;
+    }
+
+    return _params.getSearchTimeLimit() && (timer.getElapsedTimeInMilliSec() > _params.getSearchTimeLimit());
+}
+
+// a single MCTS iteration: selection, expansion, random playout and backpropagation
+void CombatSearch_MCTS::playout(const GameState & root, CombatSearch_MCTSData & tree)
+{
+    GameState   state(root);
+    BuildOrder  buildOrder(_buildOrder);
+    size_t      node = tree.root();
+    size_t      depth = 0;
+    double      integral = 0;
+    double      lastEval = 0;
+    FrameCountType lastFrame = 0;
+    size_t      startSize = buildOrder.size();
+
+    // selection: follow UCT through the fully expanded part of the tree
+    while (tree.getNode(node).expanded && !tree.getNode(node).children.empty() && !isTerminalNode(state, depth))
+    {
+        node = tree.selectChild(node);
+        doPlayoutAction(state, tree.getNode(node).action, buildOrder, integral, lastEval, lastFrame);
+        depth++;
+    }
+
+    // expansion: add all legal actions of the leaf as children and step into the first untried one
+    if (!tree.getNode(node).expanded && !isTerminalNode(state, depth))
+    {
+        ActionSet legalActions;
+        generateLegalActions(state, legalActions, _params);
+        tree.expand(node, legalActions);
+
+        if (!legalActions.isEmpty())
+        {
+            node = tree.selectChild(node);
+            doPlayoutAction(state, tree.getNode(node).action, buildOrder, integral, lastEval, lastFrame);
+            depth++;
+        }
+    }
+
+    // playout: random legal actions until the frame limit
+    while (!isTerminalNode(state, depth))
+    {
+        ActionSet legalActions;
+        generateLegalActions(state, legalActions, _params);
+
+        if (legalActions.isEmpty())
+        {
+            break;
+        }
+
+        doPlayoutAction(state, choosePlayoutAction(legalActions, tree), buildOrder, integral, lastEval, lastFrame);
+        depth++;
+    }
+
+    tree.addNodesExpanded(buildOrder.size() - startSize);
+    tree.update(integral, buildOrder);
+    tree.backpropagate(node, integral);
+}
+
+// uniformly random playouts mostly build workers and buildings and score poorly, so with probability
+// MCTSArmyBias an army unit is chosen when one is legal, the same units Eval::ArmyTotalResourceSum counts
+const ActionType & CombatSearch_MCTS::choosePlayoutAction(const ActionSet & legalActions, CombatSearch_MCTSData & tree) const
+{
+    if (tree.randomChance(_params.getMCTSArmyBias()))
+    {
+        std::vector<size_t> armyActions;
+        for (size_t a(0); a < legalActions.size(); ++a)
+        {
+            const ActionType & action = legalActions[a];
+            if (!action.isBuilding() && !action.isWorker() && !action.isSupplyProvider())
+            {
+                armyActions.push_back(a);
+            }
+        }
+
+        if (!armyActions.empty())
+        {
+            return legalActions[armyActions[tree.randomIndex(armyActions.size())]];
+        }
+    }
+
+    return legalActions[tree.randomIndex(legalActions.size())];
+}
+
+// accumulates the integral exactly as CombatSearch_IntegralData::update does when the action is added:
+// the previous army value counts up to the frame the action is issued, which is the integral that is reported
+void CombatSearch_MCTS::doPlayoutAction(GameState & state, const ActionType & action, BuildOrder & buildOrder, double & integral, double & lastEval, FrameCountType & lastFrame) const
+{
+    integral += lastEval * (state.getCurrentFrame() - lastFrame);
+    lastEval = Eval::ArmyTotalResourceSum(state);
+    lastFrame = state.getCurrentFrame();
+
+    state.doAction(action);
+    buildOrder.add(action);
+}
+
+void CombatSearch_MCTS::printResults()
+{
+    _integral.print();
+
+    unsigned long long iterations = 0;
+    size_t treeSize = 0;
+    for (size_t t(0); t < _trees.size(); ++t)
+    {
+        iterations += _trees[t].getIterations();
+        treeSize += _trees[t].getTreeSize();
+    }
+
+    std::cout << "\nMCTS: " << _trees.size() << " tree(s), " << iterations << " playouts, " << treeSize << " tree nodes\n";
+}
+
+#include "BuildOrderPlot.h"
+void CombatSearch_MCTS::writeResultsFile(const std::string & filename)
+{
+    BuildOrderPlot plot(_params.getInitialState(), _integral.getBestBuildOrder());
+
+    plot.writeResourcePlot(filename + "_Resources");
+    plot.writeRectanglePlot(filename + "_BuildOrder");
+    plot.writeArmyValuePlot(filename + "_ArmyValue");
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Common.h"
+#include "Timer.hpp"
+#include "Eval.h"
+#include "BuildOrder.h"
+#include "CombatSearch.h"
+#include "CombatSearchParameters.h"
+#include "CombatSearchResults.h"
+#include "CombatSearch_IntegralData.h"
+#include "CombatSearch_MCTSData.h"
+
+namespace BOSS
+{
+
+// Monte Carlo tree search (UCT) maximizing the same army value integral as CombatSearch_Integral
+// Playouts choose random legal actions until the frame time limit is reached, favoring army units
+// (see CombatSearchParameters::_mctsArmyBias), and the best playout found by any tree is reported
+// through CombatSearch_IntegralData so its results can be compared directly to the exhaustive search
+class CombatSearch_MCTS : public CombatSearch
+{
+    CombatSearch_IntegralData           _integral;
+    std::vector<CombatSearch_MCTSData>  _trees;
+
+    virtual void                recurse(const GameState & s, size_t depth);
+
+    void                        searchTree(const GameState & root, CombatSearch_MCTSData & tree);
+    void                        playout(const GameState & root, CombatSearch_MCTSData & tree);
+    const ActionType &          choosePlayoutAction(const ActionSet & legalActions, CombatSearch_MCTSData & tree) const;
+    void                        doPlayoutAction(GameState & state, const ActionType & action, BuildOrder & buildOrder, double & integral, double & lastEval, FrameCountType & lastFrame) const;
+    bool                        iterationLimitReached(const CombatSearch_MCTSData & tree, Timer & timer) const;
+
+public:
+
+    CombatSearch_MCTS(const CombatSearchParameters p = CombatSearchParameters());
+
+    virtual void printResults();
+    virtual void writeResultsFile(const std::string & filename);
+};
+
+}
@@ -0,0 +1,155 @@
+#include "CombatSearch_MCTSData.h"
+
+using namespace BOSS;
+
+// Combat Search UCT Tree
+//
+// Nodes only store the action which generated them, states are recreated during selection
+// by applying the actions from the root. This keeps the tree small enough to grow for the
+// entire search time instead of storing a GameState per node.
+//
+// Only the best build order is reported, so children are scored by the best playout seen
+// through them rather than the mean, which single player search is free to do.
+
+CombatSearch_MCTSData::CombatSearch_MCTSData(const double exploration, const unsigned int seed)
+    : _rng(seed)
+    , _exploration(exploration)
+    , _maxValue(0)
+    , _bestValue(-1)
+    , _nodesExpanded(0)
+    , _iterations(0)
+{
+    _nodes.push_back(MCTSNode(ActionType(), 0));
+}
+
+const size_t CombatSearch_MCTSData::root() const
+{
+    return 0;
+}
+
+const MCTSNode & CombatSearch_MCTSData::getNode(const size_t index) const
+{
+    BOSS_ASSERT(index < _nodes.size(), "MCTS node index out of bounds: %d", (int)index);
+
+    return _nodes[index];
+}
+
+size_t CombatSearch_MCTSData::selectChild(const size_t index) const
+{
+    const MCTSNode & node = _nodes[index];
+
+    BOSS_ASSERT(!node.children.empty(), "Can't select a child of a node with no children");
+
+    const double logParentVisits = std::log((double)std::max(node.visits, 1u));
+    const double normalize = _maxValue > 0 ? _maxValue : 1;
+
+    size_t bestChild = node.children[0];
+    double bestScore = -1;
+
+    for (size_t c(0); c < node.children.size(); ++c)
+    {
+        const MCTSNode & child = _nodes[node.children[c]];
+
+        // always try every child once before using the UCT formula
+        if (child.visits == 0)
+        {
+            return node.children[c];
+        }
+
+        double exploit = child.bestValue / normalize;
+        double explore = _exploration * std::sqrt(logParentVisits / child.visits);
+
+        if (exploit + explore > bestScore)
+        {
+            bestScore = exploit + explore;
+            bestChild = node.children[c];
+        }
+    }
+
+    return bestChild;
+}
+
+void CombatSearch_MCTSData::expand(const size_t index, const ActionSet & legalActions)
+{
+    BOSS_ASSERT(!_nodes[index].expanded, "MCTS node has already been expanded");
+
+    for (size_t a(0); a < legalActions.size(); ++a)
+    {
+        _nodes[index].children.push_back(_nodes.size());
+        _nodes.push_back(MCTSNode(legalActions[a], index));
+    }
+
+    _nodes[index].expanded = true;
+}
+
+void CombatSearch_MCTSData::backpropagate(const size_t index, const double value)
+{
+    size_t current = index;
+
+    while (true)
+    {
+        _nodes[current].visits++;
+        _nodes[current].bestValue = std::max(_nodes[current].bestValue, value);
+
+        if (current == root())
+        {
+            break;
+        }
+
+        current = _nodes[current].parent;
+    }
+
+    _maxValue = std::max(_maxValue, value);
+    _iterations++;
+}
+
+size_t CombatSearch_MCTSData::randomIndex(const size_t size)
+{
+    BOSS_ASSERT(size > 0, "Can't choose a random index of an empty set");
+
+    return std::uniform_int_distribution<size_t>(0, size - 1)(_rng);
+}
+
+bool CombatSearch_MCTSData::randomChance(const double probability)
+{
+    return std::uniform_real_distribution<double>(0, 1)(_rng) < probability;
+}
+
+void CombatSearch_MCTSData::update(const double value, const BuildOrder & buildOrder)
+{
+    if ((value > _bestValue) || ((value == _bestValue) && Eval::BuildOrderBetter(buildOrder, _bestBuildOrder)))
+    {
+        _bestValue = value;
+        _bestBuildOrder = buildOrder;
+    }
+}
+
+void CombatSearch_MCTSData::addNodesExpanded(const unsigned long long nodes)
+{
+    _nodesExpanded += nodes;
+}
+
+const double CombatSearch_MCTSData::getBestValue() const
+{
+    return _bestValue;
+}
+
+const BuildOrder & CombatSearch_MCTSData::getBestBuildOrder() const
+{
+    return _bestBuildOrder;
+}
+
+const unsigned long long CombatSearch_MCTSData::getNodesExpanded() const
+{
+    return _nodesExpanded;
+}
+
+const unsigned long long CombatSearch_MCTSData::getIterations() const
+{
+    return _iterations;
+}
+
+const size_t CombatSearch_MCTSData::getTreeSize() const
+{
+    return _nodes.size();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Common.h"
+#include "GameState.h"
+#include "ActionSet.h"
+#include "BuildOrder.h"
+#include "Eval.h"
+#include <random>
+
+namespace BOSS
+{
+
+class MCTSNode
+{
+public:
+    ActionType          action;         // the action which generated this node from its parent
+    size_t              parent;
+    std::vector<size_t> children;
+    bool                expanded;
+    unsigned int        visits;
+    double              bestValue;      // highest playout value seen through this node
+
+    MCTSNode(const ActionType & a, const size_t p)
+        : action(a)
+        , parent(p)
+        , expanded(false)
+        , visits(0)
+        , bestValue(0)
+    {
+
+    }
+};
+
+// A single UCT tree along with the best playout it has ever seen
+// Each tree owns its own random number generator so that several of them
+// can be searched in parallel from the same root (root parallelism)
+class CombatSearch_MCTSData
+{
+    std::vector<MCTSNode>       _nodes;
+    std::mt19937                _rng;
+    double                      _exploration;
+    double                      _maxValue;          // highest playout value seen, used to normalize values to [0,1]
+
+    double                      _bestValue;
+    BuildOrder                  _bestBuildOrder;
+
+    unsigned long long          _nodesExpanded;
+    unsigned long long          _iterations;
+
+public:
+
+    CombatSearch_MCTSData(const double exploration, const unsigned int seed);
+
+    const size_t                root() const;
+    const MCTSNode &            getNode(const size_t index) const;
+
+    size_t                      selectChild(const size_t index) const;
+    void                        expand(const size_t index, const ActionSet & legalActions);
+    void                        backpropagate(const size_t index, const double value);
+    size_t                      randomIndex(const size_t size);
+    bool                        randomChance(const double probability);
+
+    void                        update(const double value, const BuildOrder & buildOrder);
+    void                        addNodesExpanded(const unsigned long long nodes);
+
+    const double                getBestValue() const;
+    const BuildOrder &          getBestBuildOrder() const;
+    const unsigned long long    getNodesExpanded() const;
+    const unsigned long long    getIterations() const;
+    const size_t                getTreeSize() const;
+};
+
+}
@@ -327,6 +327,7 @@ const DFBB_BuildOrderSearchParameters & DFBB_BuildOrderSmartSearch::getParameter
     _params.useIncreasingRepetitions 	= true;
     _params.useAlwaysMakeWorkers 		= true;
     _params.useSupplyBounding 			= true;
+    _params.relevantActions             = _relevantActions;
 
     return _params;
 }
@@ -4,10 +4,10 @@ using namespace BOSS;
 
 DFBB_BuildOrderStackSearch::DFBB_BuildOrderStackSearch(const DFBB_BuildOrderSearchParameters & p)
     : _params(p)
+    , _stack(100, StackData())
     , _depth(0)
     , _firstSearch(true)
     , _wasInterrupted(false)
-    , _stack(100, StackData())
 {
     
 }
@@ -103,6 +103,94 @@ namespace Eval
 
         return true;
     }
+
+    // number of action's units which state has finished by the given frame, counting those still in progress
+    static UnitCountType NumFinishedBy(const GameState & state, const ActionType & action, const FrameCountType frame)
+    {
+        const UnitData & units = state.getUnitData();
+        UnitCountType num = units.getNumCompleted(action);
+
+        for (UnitCountType i(0); i < units.getNumActionsInProgress(); ++i)
+        {
+            if ((units.getActionInProgressByIndex(i) == action) && (units.getActionInProgressFinishTimeByIndex(i) <= frame))
+            {
+                num++;
+            }
+        }
+
+        return num;
+    }
+
+    // number of buildings like building which state has free by the given frame
+    static UnitCountType NumBuildingsFreeBy(const GameState & state, const BuildingStatus & building, const FrameCountType frame)
+    {
+        const BuildingData & buildings = state.getBuildingData();
+        UnitCountType num = 0;
+
+        for (UnitCountType i(0); i < buildings.size(); ++i)
+        {
+            const BuildingStatus & b = buildings.getBuilding(i);
+            if ((b._type == building._type) && (b._addon == building._addon) && (state.getCurrentFrame() + b._timeRemaining <= frame))
+            {
+                num++;
+            }
+        }
+
+        return num;
+    }
+
+    // StateDominates, and also state can match every future event of other no later:
+    // each unit other has in progress is matched by one of state's finishing no later,
+    // each of other's buildings by one of state's which is free no later,
+    // and state has at least as many mineral and gas workers, larva and free supply
+    bool StateDominatesInTime(const GameState & state, const GameState & other)
+    {
+        if ((state.getCurrentFrame() > other.getCurrentFrame()) || !StateDominates(state, other))
+        {
+            return false;
+        }
+
+        const UnitData & units = state.getUnitData();
+        const UnitData & otherUnits = other.getUnitData();
+
+        if ((units.getNumMineralWorkers() < otherUnits.getNumMineralWorkers())
+            || (units.getNumGasWorkers() < otherUnits.getNumGasWorkers())
+            || (state.getHatcheryData().numLarva() < other.getHatcheryData().numLarva()))
+        {
+            return false;
+        }
+
+        if ((int)units.getMaxSupply() - (int)units.getCurrentSupply() < (int)otherUnits.getMaxSupply() - (int)otherUnits.getCurrentSupply())
+        {
+            return false;
+        }
+
+        // it is enough to check at the frames where other gains something
+        for (UnitCountType i(0); i < otherUnits.getNumActionsInProgress(); ++i)
+        {
+            const ActionType & action = otherUnits.getActionInProgressByIndex(i);
+            const FrameCountType finishTime = otherUnits.getActionInProgressFinishTimeByIndex(i);
+
+            if (NumFinishedBy(state, action, finishTime) < NumFinishedBy(other, action, finishTime))
+            {
+                return false;
+            }
+        }
+
+        const BuildingData & otherBuildings = other.getBuildingData();
+        for (UnitCountType i(0); i < otherBuildings.size(); ++i)
+        {
+            const BuildingStatus & building = otherBuildings.getBuilding(i);
+            const FrameCountType freeTime = other.getCurrentFrame() + building._timeRemaining;
+
+            if (NumBuildingsFreeBy(state, building, freeTime) < NumBuildingsFreeBy(other, building, freeTime))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
 }
 
@@ -15,5 +15,6 @@ namespace Eval
     bool BuildOrderBetter(const BuildOrder & buildOrder, const BuildOrder & compareTo);
 
     bool StateDominates(const GameState & state, const GameState & other);
+    bool StateDominatesInTime(const GameState & state, const GameState & other);
 }
 }
@@ -150,7 +150,10 @@ GameState::GameState(BWAPI::GameWrapper & game, BWAPI::PlayerInterface * self, c
                     }
                 }
 
-                _units.addCompletedBuilding(actionType, trainTime, constructing, addon, unit->getLarva().size());
+                // a hatchery's remaining train time is the time until its next larva spawns, which gives its spawn phase
+                FrameCountType larvaPhase = isHatchery ? (game->getFrameCount() + unit->getRemainingTrainTime()) % Constants::ZERG_LARVA_TIMER : 0;
+
+                _units.addCompletedBuilding(actionType, trainTime, constructing, addon, unit->getLarva().size(), larvaPhase);
 			}
             // otherwise it is a non-building unit
             else
@@ -174,7 +177,7 @@ GameState::GameState(BWAPI::GameWrapper & game, BWAPI::PlayerInterface * self, c
             if (actionType.isBuilding() && actionType.isMorphed())
             {
                 // add the completed building which is morphing into this building
-                _units.addCompletedBuilding(actionType.whatBuildsActionType(), unit->getRemainingBuildTime(), actionType, ActionType(), unit->getLarva().size());
+                _units.addCompletedBuilding(actionType.whatBuildsActionType(), unit->getRemainingBuildTime(), actionType, ActionType(), unit->getLarva().size(), (game->getFrameCount() + unit->getRemainingTrainTime()) % Constants::ZERG_LARVA_TIMER);
             }
 
             // add the unit itself in progress
@@ -212,6 +215,8 @@ GameState::GameState(BWAPI::GameWrapper & game, BWAPI::PlayerInterface * self, c
 
 void GameState::setStartingState()
 {
+    _income.invalidate();
+
     _minerals = 50 * Constants::RESOURCE_SCALE;
     _gas = 0;
 
@@ -340,14 +345,15 @@ std::vector<ActionType> GameState::doAction(const ActionType & action)
 {
     BOSS_ASSERT(action.getRace() == _race, "Race of action does not match race of the state");
 
+#ifdef BOSS_GAMESTATE_ACTION_HISTORY
     _actionsPerformed.push_back(ActionPerformed());
     _actionsPerformed[_actionsPerformed.size()-1].actionType = action;
+#endif
 
     BOSS_ASSERT(isLegal(action), "Trying to perform an illegal action: %s %s", action.getName().c_str(), getActionsPerformedString().c_str());
     
     // set the actionPerformed
     _actionPerformed = action;
-    _actionPerformedK = 1;
 
     FrameCountType workerReadyTime = whenWorkerReady(action);
     FrameCountType ffTime = whenCanPerform(action);
@@ -358,9 +364,11 @@ std::vector<ActionType> GameState::doAction(const ActionType & action)
 
     auto actionsFinished = fastForward(ffTime);
 
+#ifdef BOSS_GAMESTATE_ACTION_HISTORY
     _actionsPerformed[_actionsPerformed.size()-1].actionQueuedFrame = _currentFrame;
     _actionsPerformed[_actionsPerformed.size()-1].gasWhenQueued = _gas;
     _actionsPerformed[_actionsPerformed.size()-1].mineralsWhenQueued = _minerals;
+#endif
 
     // how much time has elapsed since the last action was queued?
     FrameCountType elapsed(_currentFrame - _lastActionFrame);
@@ -415,12 +423,17 @@ std::vector<ActionType> GameState::doAction(const ActionType & action)
         }
      }
 
+    // the action just queued changes the future income
+    _income.invalidate();
+
 	return actionsFinished;
 }
 
 // fast forwards the current state to time toFrame
 std::vector<ActionType> GameState::fastForward(const FrameCountType toFrame)
 {
+    _income.invalidate();
+
     // fast forward the building timers to the current frame
     FrameCountType previousFrame = _currentFrame;
     _units.setBuildingFrame(toFrame - _currentFrame);
@@ -713,93 +726,8 @@ const FrameCountType GameState::whenMineralsReady(const ActionType & action) con
     {
         return getCurrentFrame();
     }
-    
-    UnitCountType currentMineralWorkers     = _units.getNumMineralWorkers();
-    UnitCountType currentGasWorkers         = _units.getNumGasWorkers();
-    FrameCountType lastActionFinishFrame    = _currentFrame;
-    FrameCountType addedTime                = 0;
-    ResourceCountType addedMinerals         = 0;
-    ResourceCountType difference            = action.mineralPrice() - _minerals;
-
-    // loop through each action in progress, adding the minerals we would gather from each interval
-    for (size_t i(0); i<_units.getNumActionsInProgress(); ++i)
-    {
-        // the vector is sorted in descending order
-        size_t progressIndex = _units.getNumActionsInProgress() - i - 1;
-
-        // the time elapsed and the current minerals per frame
-        FrameCountType elapsed = _units.getFinishTimeByIndex(progressIndex) - lastActionFinishFrame;
-        ResourceCountType mineralsPerFrame = (currentMineralWorkers * Constants::MPWPF);
-
-        // the amount of minerals that would be added this time step
-        ResourceCountType tempAdd = elapsed * mineralsPerFrame;
 
-        // if this amount isn't enough, update the amount added for this interval
-        if (addedMinerals + tempAdd < difference)
-        {
-            addedMinerals += tempAdd;
-            addedTime += elapsed;
-        }
-        else
-        {
-            // otherwise we can just break out and update at the end
-            break;
-        }
-
-        // if it was a drone or extractor update the temp variables
-        const ActionType & actionPerformed = _units.getActionInProgressByIndex(progressIndex);
-
-        // finishing a building as terran gives you a mineral worker back
-        if (actionPerformed.isBuilding() && !actionPerformed.isAddon() && (getRace() == Races::Terran))
-        {
-            currentMineralWorkers++;
-        }
-
-        if (actionPerformed.isWorker())
-        {
-            currentMineralWorkers++;
-        }
-        else if (actionPerformed.isRefinery())
-        {
-            BOSS_ASSERT(currentMineralWorkers > 3, "Not enough mineral workers \n");
-            currentMineralWorkers -= 3; 
-            currentGasWorkers += 3;
-        }
-
-
-        // update the last action
-        lastActionFinishFrame = _units.getFinishTimeByIndex(progressIndex);
-    }
-
-    // if we still haven't added enough minerals, add more time
-    if (addedMinerals < difference)
-    {
-        BOSS_ASSERT(currentMineralWorkers > 0, "Shouldn't have 0 mineral workers");
-
-       FrameCountType finalTimeToAdd;
-	   if (currentMineralWorkers != 0)
-		{
-			finalTimeToAdd = (difference - addedMinerals) / (currentMineralWorkers * Constants::MPWPF);
-		}
-		else
-		{
-			finalTimeToAdd = 1000000;
-		}
-        addedMinerals += finalTimeToAdd * currentMineralWorkers * Constants::MPWPF;
-        addedTime     += finalTimeToAdd;
-
-        // the last operation could have added one frame too little due to integer division so we need to check
-        if (addedMinerals < difference)
-        {
-            addedTime += 1;
-            addedMinerals += currentMineralWorkers * Constants::MPWPF;
-        }
-    }
-    
-    BOSS_ASSERT(addedMinerals >= difference, "Mineral prediction error");
-
-    // for some reason if i don't return +1, i mine 1 less mineral in the interval
-    return _currentFrame + addedTime;
+    return getIncomeModel().whenMineralsGathered(action.mineralPrice() - _minerals);
 }
 
 const FrameCountType GameState::whenGasReady(const ActionType & action) const
@@ -808,90 +736,19 @@ const FrameCountType GameState::whenGasReady(const ActionType & action) const
     {
         return getCurrentFrame();
     }
-    
-    UnitCountType currentMineralWorkers     = _units.getNumMineralWorkers();
-    UnitCountType currentGasWorkers         = _units.getNumGasWorkers();
-    FrameCountType lastActionFinishFrame    = _currentFrame;
-    FrameCountType addedTime                = 0;
-    ResourceCountType addedGas              = 0;
-    ResourceCountType difference            = action.gasPrice() - _gas;
-
-    // loop through each action in progress, adding the minerals we would gather from each interval
-    for (size_t i(0); i<_units.getNumActionsInProgress(); ++i)
-    {
-        // the vector is sorted in descending order
-        size_t progressIndex = _units.getNumActionsInProgress() - i - 1;
-
-        // the time elapsed and the current minerals per frame
-        FrameCountType elapsed = _units.getFinishTimeByIndex(progressIndex) - lastActionFinishFrame;
-        ResourceCountType gasPerFrame = (currentGasWorkers * Constants::GPWPF);
-
-        // the amount of minerals that would be added this time step
-        ResourceCountType tempAdd = elapsed * gasPerFrame;
-
-        // if this amount isn't enough, update the amount added for this interval
-        if (addedGas + tempAdd < difference)
-        {
-            addedGas += tempAdd;
-            addedTime += elapsed;
-        }
-        else
-        {
-            // otherwise we can just break out and update at the end
-            break;
-        }
-
-        // if it was a drone or extractor update the temp variables
-        const ActionType & actionPerformed = _units.getActionInProgressByIndex(progressIndex);
-
-        // finishing a building as terran gives you a mineral worker back
-        if (actionPerformed.isBuilding() && !actionPerformed.isAddon() && (getRace() == Races::Terran))
-        {
-            currentMineralWorkers++;
-        }
-
-        if (actionPerformed.isWorker())
-        {
-            currentMineralWorkers++;
-        }
-        else if (actionPerformed.isRefinery())
-        {
-            BOSS_ASSERT(currentMineralWorkers > 3, "Not enough mineral workers");
-            currentMineralWorkers -= 3; currentGasWorkers += 3;
-        }
 
-        // update the last action
-        lastActionFinishFrame = _units.getFinishTimeByIndex(progressIndex);
-    }
+    return getIncomeModel().whenGasGathered(action.gasPrice() - _gas);
+}
 
-    // if we still haven't added enough minerals, add more time
-    if (addedGas < difference)
+// the income model only depends on the units in progress, so it is built on first use and kept until the state changes
+const IncomeModel & GameState::getIncomeModel() const
+{
+    if (!_income.isValid())
     {
-		BOSS_ASSERT(currentGasWorkers > 0, "Shouldn't have 0 gas workers");
-		FrameCountType finalTimeToAdd;
-		if (currentGasWorkers != 0)
-		{
-			finalTimeToAdd = (difference - addedGas) / (currentGasWorkers * Constants::GPWPF);
-		}
-		else
-		{
-			finalTimeToAdd = 1000000;
-		}
-        addedGas    += finalTimeToAdd * currentGasWorkers * Constants::GPWPF;
-        addedTime   += finalTimeToAdd;
-
-        // the last operation could have added one frame too little due to integer division so we need to check
-        if (addedGas < difference)
-        {
-            addedTime += 1;
-            addedGas += currentGasWorkers * Constants::GPWPF;
-        }
+        _income.build(_units, _currentFrame);
     }
-    
-    BOSS_ASSERT(addedGas >= difference, "Gas prediction error");
 
-    // for some reason if i don't return +1, i mine 1 less mineral in the interval
-    return _currentFrame + addedTime;
+    return _income;
 }
 
 const FrameCountType GameState::getCurrentFrame() const
@@ -960,14 +817,14 @@ const ResourceCountType GameState::getMinerals(const int frame) const
 {
     BOSS_ASSERT(frame >= _currentFrame, "Frame is not in the future");
 
-    return _minerals + (int)(getMineralsPerFrame() * (frame-_currentFrame));
+    return _minerals + getIncomeModel().getMineralsGathered(frame);
 }
 
 const ResourceCountType GameState::getGas(const int frame) const
 {
     BOSS_ASSERT(frame >= _currentFrame, "Frame is not in the future");
 
-    return _gas + (int)(getGasPerFrame() * (frame-_currentFrame));
+    return _gas + getIncomeModel().getGasGathered(frame);
 }
 
 const ResourceCountType GameState::getFinishTimeMinerals() const
@@ -1007,6 +864,8 @@ void GameState::setGas(const ResourceCountType & gas)
 
 void GameState::addCompletedAction(const ActionType & action, const size_t num)
 {
+    _income.invalidate();
+
     for (size_t i(0); i < num; ++i)
     {
         _units.addCompletedAction(action, false);
@@ -1016,6 +875,8 @@ void GameState::addCompletedAction(const ActionType & action, const size_t num)
 
 void GameState::removeCompletedAction(const ActionType & action, const size_t num)
 {
+    _income.invalidate();
+
 	for (size_t i(0); i < num; ++i)
 	{
 		_units.setCurrentSupply(_units.getCurrentSupply() - action.supplyRequired());
@@ -1083,10 +944,14 @@ const std::string GameState::getActionsPerformedString() const
 {
     std::stringstream ss;
     ss << std::endl;
+#ifdef BOSS_GAMESTATE_ACTION_HISTORY
     for (size_t a(0); a<_actionsPerformed.size(); ++a)
     {
         ss << (int)_actionsPerformed[a].actionQueuedFrame << " " << (int)_actionsPerformed[a].mineralsWhenQueued << " " << (int)_actionsPerformed[a].gasWhenQueued << " " << _actionsPerformed[a].actionType.getName() << std::endl;
     }
+#else
+    ss << "(action history disabled, define BOSS_GAMESTATE_ACTION_HISTORY)" << std::endl;
+#endif
 
     return ss.str();
 }
@@ -8,9 +8,15 @@
 #include "ActionType.h"
 #include "PrerequisiteSet.h"
 #include "ActionSet.h"
+#include "IncomeModel.h"
 
 //#define ENABLE_BWAPI_GAMESTATE_CONSTRUCTOR
 
+// keep the full list of actions performed in every state, for debugging only
+// searches copy a state per node and already keep the build order on their own stack, so this
+// is off by default to keep states small and free of heap allocations
+//#define BOSS_GAMESTATE_ACTION_HISTORY
+
 namespace BOSS
 {
     
@@ -40,7 +46,6 @@ class GameState
     RaceID                      _race;
 
     ActionType                  _actionPerformed; 		    // the action which generated this state
-    size_t                      _actionPerformedK;
 
     FrameCountType              _currentFrame;
     FrameCountType              _lastActionFrame;		    // the current frame of the game
@@ -48,7 +53,13 @@ class GameState
     ResourceCountType           _minerals; 			        // current mineral count
     ResourceCountType           _gas;						// current gas count
 
+#ifdef BOSS_GAMESTATE_ACTION_HISTORY
     std::vector<ActionPerformed>   _actionsPerformed;
+#endif
+
+    mutable IncomeModel         _income;                    // cached projection of future income, rebuilt when the state changes
+
+    const IncomeModel &         getIncomeModel()                                                        const;
 
     const FrameCountType        raceSpecificWhenReady(const ActionType & a) const;
     void                        fixZergUnitMasks();
@@ -97,7 +108,7 @@ public:
 
     const UnitData &            getUnitData()                   const;
 
-    const ResourceCountType     getMinerals(const int frame)    const;
+    const ResourceCountType     getMinerals(const int frame)    const;      // projected, including workers and refineries in progress
     const ResourceCountType     getGas(const int frame)         const;
     const ResourceCountType     getFinishTimeMinerals()         const;
     const ResourceCountType     getFinishTimeGas()              const;
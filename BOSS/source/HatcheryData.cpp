@@ -2,24 +2,28 @@
 
 using namespace BOSS;
 
-Hatchery::Hatchery(const UnitCountType & numLarva) 
+Hatchery::Hatchery(const UnitCountType & numLarva, const FrameCountType & larvaPhase) 
 	: _numLarva(numLarva)
+    , _larvaPhase(larvaPhase % Constants::ZERG_LARVA_TIMER)
 {
 }
 
 Hatchery::Hatchery() 
 	: _numLarva(3)
+    , _larvaPhase(0)
 {
 }
 
 void Hatchery::fastForward(const FrameCountType & currentFrame, const FrameCountType & toFrame)
 {
-    if (_numLarva == 3)
+    if (_numLarva >= 3)
     {
         return;
     }
 
-    UnitCountType  larvaToAdd   = (toFrame / Constants::ZERG_LARVA_TIMER) - (currentFrame / Constants::ZERG_LARVA_TIMER);
+    // count the spawn frames in (currentFrame, toFrame], shifted so the division never sees a negative frame
+    const FrameCountType shift  = Constants::ZERG_LARVA_TIMER - _larvaPhase;
+    UnitCountType  larvaToAdd   = ((toFrame + shift) / Constants::ZERG_LARVA_TIMER) - ((currentFrame + shift) / Constants::ZERG_LARVA_TIMER);
 
     larvaToAdd                  = std::min(larvaToAdd, (UnitCountType)(3 - _numLarva));
 
@@ -33,32 +37,85 @@ void Hatchery::useLarva()
     _numLarva--;
 }
 
+// the first frame after currentFrame that this hatchery spawns a larva on
+const FrameCountType Hatchery::nextLarvaFrameAfter(const FrameCountType & currentFrame) const
+{
+    const FrameCountType sinceLastSpawn = (currentFrame + Constants::ZERG_LARVA_TIMER - _larvaPhase) % Constants::ZERG_LARVA_TIMER;
+
+    return currentFrame + Constants::ZERG_LARVA_TIMER - sinceLastSpawn;
+}
+
 const UnitCountType & Hatchery::numLarva() const
 {
     return _numLarva;
 }
 
+const FrameCountType Hatchery::larvaPhase() const
+{
+    return _larvaPhase;
+}
+
 HatcheryData::HatcheryData()
+    : _numLarva(0)
+    , _nextLarvaFrame(0)
 {
 
 }
 
-void HatcheryData::addHatchery(const UnitCountType & numLarva)
+void HatcheryData::addHatchery(const UnitCountType & numLarva, const FrameCountType & larvaPhase)
 {
-    _hatcheries.push_back(Hatchery(numLarva));
+    _hatcheries.push_back(Hatchery(numLarva, larvaPhase));
+    _numLarva += numLarva;
+    _nextLarvaFrame = 0;
 }
 
 void HatcheryData::removeHatchery()
 {
+    _numLarva -= _hatcheries[_hatcheries.size() - 1].numLarva();
 	_hatcheries.pop_back();
+    _nextLarvaFrame = 0;
+}
+
+void HatcheryData::calculateNextLarvaFrame(const FrameCountType & currentFrame)
+{
+    _nextLarvaFrame = std::numeric_limits<FrameCountType>::max();
+
+    for (size_t i(0); i < _hatcheries.size(); ++i)
+    {
+        if (_hatcheries[i].numLarva() < 3)
+        {
+            _nextLarvaFrame = std::min(_nextLarvaFrame, _hatcheries[i].nextLarvaFrameAfter(currentFrame));
+        }
+    }
 }
 
 void HatcheryData::fastForward(const FrameCountType & currentFrame, const FrameCountType & toFrame)
 {
+    // every hatchery is full so nothing can spawn
+    if (_numLarva >= 3 * _hatcheries.size())
+    {
+        return;
+    }
+
+    if (_nextLarvaFrame == 0)
+    {
+        calculateNextLarvaFrame(currentFrame);
+    }
+
+    // no hatchery spawns a larva before toFrame
+    if (toFrame < _nextLarvaFrame)
+    {
+        return;
+    }
+
+    _numLarva = 0;
     for (size_t i(0); i < _hatcheries.size(); ++i)
     {
         _hatcheries[i].fastForward(currentFrame, toFrame);
+        _numLarva += _hatcheries[i].numLarva();
     }
+
+    calculateNextLarvaFrame(toFrame);
 }
 
 void HatcheryData::useLarva()
@@ -78,6 +135,10 @@ void HatcheryData::useLarva()
     if (maxLarvaIndex != -1)
     {
         _hatcheries[maxLarvaIndex].useLarva();
+        _numLarva--;
+
+        // the hatchery may have been full, in which case it spawns again sooner than the cached frame
+        _nextLarvaFrame = 0;
     }
     else
     {
@@ -85,8 +146,24 @@ void HatcheryData::useLarva()
     }
 }
 
+// the first frame after currentFrame that any hatchery which isn't full spawns a larva on
 const FrameCountType HatcheryData::nextLarvaFrameAfter(const FrameCountType & currentFrame) const
 {
+    FrameCountType nextLarvaFrame = std::numeric_limits<FrameCountType>::max();
+
+    for (size_t i(0); i < _hatcheries.size(); ++i)
+    {
+        if (_hatcheries[i].numLarva() < 3)
+        {
+            nextLarvaFrame = std::min(nextLarvaFrame, _hatcheries[i].nextLarvaFrameAfter(currentFrame));
+        }
+    }
+
+    if (nextLarvaFrame != std::numeric_limits<FrameCountType>::max())
+    {
+        return nextLarvaFrame;
+    }
+
     if (currentFrame % Constants::ZERG_LARVA_TIMER == 0)
     {
         return currentFrame + Constants::ZERG_LARVA_TIMER;
@@ -99,14 +176,7 @@ const FrameCountType HatcheryData::nextLarvaFrameAfter(const FrameCountType & cu
 
 const UnitCountType HatcheryData::numLarva() const
 {
-    UnitCountType sumLarva = 0;
-
-    for (size_t i(0); i < _hatcheries.size(); ++i)
-    {
-        sumLarva += _hatcheries[i].numLarva();
-    }
-
-    return sumLarva;
+    return _numLarva;
 }
 
 const UnitCountType HatcheryData::size() const
@@ -5,6 +5,7 @@
 #include <string.h>
 #include <queue>
 #include <algorithm>
+#include <limits>
 
 #include "PrerequisiteSet.h"
 #include "Array.hpp"
@@ -13,31 +14,43 @@
 namespace BOSS
 {
 
+// A hatchery spawns a larva every ZERG_LARVA_TIMER frames while it has fewer than 3
+// Spawns happen on the frames where frame % ZERG_LARVA_TIMER == larvaPhase, so the larva a
+// hatchery has at any future frame follows directly from its count and phase
 class Hatchery
 { 
     UnitCountType           _numLarva;
+    unsigned short          _larvaPhase;        // always less than ZERG_LARVA_TIMER
 	
 public:
 	
-	Hatchery(const UnitCountType & numLarva);
+	Hatchery(const UnitCountType & numLarva, const FrameCountType & larvaPhase = 0);
 	Hatchery();
 
        
     void                    useLarva();
     void                    fastForward(const FrameCountType & currentFrame, const FrameCountType & toFrame);
 
+    const FrameCountType    nextLarvaFrameAfter(const FrameCountType & currentFrame) const;
     const UnitCountType &   numLarva() const;
+    const FrameCountType    larvaPhase() const;
 };
 
+// Larva counts are cached so asking how many larva we have doesn't visit every hatchery, and the
+// earliest spawn of any hatchery is cached so fast forwarding past no spawn does no work
 class HatcheryData
 {
     Vec<Hatchery, Constants::MAX_HATCHERIES> _hatcheries;
+    UnitCountType                            _numLarva;
+    FrameCountType                           _nextLarvaFrame;   // earliest larva spawn of any hatchery, 0 if it needs recalculating
+
+    void                    calculateNextLarvaFrame(const FrameCountType & currentFrame);
 
 public:
 
     HatcheryData();
 
-    void                    addHatchery(const UnitCountType & numLarva);
+    void                    addHatchery(const UnitCountType & numLarva, const FrameCountType & larvaPhase = 0);
 	void                    removeHatchery();
     void                    useLarva();
     void                    fastForward(const FrameCountType & currentFrame, const FrameCountType & toFrame);
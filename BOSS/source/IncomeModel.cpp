@@ -0,0 +1,181 @@
+#include "IncomeModel.h"
+
+using namespace BOSS;
+
+// frames added when income has stopped, as far out as the old per-query simulation put it
+static const FrameCountType NeverGathered = 1000000;
+
+IncomeSegment::IncomeSegment(const FrameCountType f, const ResourceCountType m, const ResourceCountType g, const UnitCountType mw, const UnitCountType gw)
+    : frame(f)
+    , minerals(m)
+    , gas(g)
+    , mineralWorkers(mw)
+    , gasWorkers(gw)
+{
+
+}
+
+IncomeModel::IncomeModel()
+    : _valid(false)
+{
+
+}
+
+// the other model is deliberately not copied: a GameState is copied to be changed right away,
+// so copying its segments would only be wasted work before the next doAction invalidates them
+IncomeModel::IncomeModel(const IncomeModel & /* other */)
+    : _valid(false)
+{
+
+}
+
+IncomeModel & IncomeModel::operator = (const IncomeModel & /* other */)
+{
+    invalidate();
+    return *this;
+}
+
+bool IncomeModel::isValid() const
+{
+    return _valid;
+}
+
+void IncomeModel::invalidate()
+{
+    _valid = false;
+}
+
+// walks the actions in progress in the order they finish, with the same worker changes UnitData makes
+void IncomeModel::build(const UnitData & units, const FrameCountType currentFrame)
+{
+    _segments.clear();
+    _segments.push_back(IncomeSegment(currentFrame, 0, 0, units.getNumMineralWorkers(), units.getNumGasWorkers()));
+
+    for (size_t i(0); i < units.getNumActionsInProgress(); ++i)
+    {
+        // the vector is sorted in descending order
+        const size_t progressIndex = units.getNumActionsInProgress() - i - 1;
+        const ActionType & action = units.getActionInProgressByIndex(progressIndex);
+
+        UnitCountType mineralWorkers = _segments.back().mineralWorkers;
+        UnitCountType gasWorkers = _segments.back().gasWorkers;
+
+        // finishing a building as terran gives you a mineral worker back
+        if (action.isBuilding() && !action.isAddon() && (units.getRace() == Races::Terran))
+        {
+            mineralWorkers++;
+        }
+
+        if (action.isWorker())
+        {
+            mineralWorkers++;
+        }
+        else if (action.isRefinery())
+        {
+            // a refinery finishing with fewer than 3 mineral workers gets only the ones there are
+            const UnitCountType transferred = std::min(mineralWorkers, UnitCountType(3));
+            mineralWorkers -= transferred;
+            gasWorkers += transferred;
+        }
+
+        // only actions which change the income start a new segment
+        if (mineralWorkers == _segments.back().mineralWorkers && gasWorkers == _segments.back().gasWorkers)
+        {
+            continue;
+        }
+
+        const IncomeSegment & last = _segments.back();
+        const FrameCountType finishFrame = units.getFinishTimeByIndex(progressIndex);
+        const FrameCountType elapsed = finishFrame - last.frame;
+
+        _segments.push_back(IncomeSegment(finishFrame, 
+                                          last.minerals + elapsed * last.mineralWorkers * Constants::MPWPF, 
+                                          last.gas + elapsed * last.gasWorkers * Constants::GPWPF, 
+                                          mineralWorkers, gasWorkers));
+    }
+
+    _valid = true;
+}
+
+// returns the first frame by which at least amount minerals have been gathered
+const FrameCountType IncomeModel::whenMineralsGathered(const ResourceCountType amount) const
+{
+    BOSS_ASSERT(_valid, "Income model used before being built");
+
+    for (size_t s(0); s < _segments.size(); ++s)
+    {
+        const IncomeSegment & segment = _segments[s];
+        const ResourceCountType rate = segment.mineralWorkers * Constants::MPWPF;
+        const bool lastSegment = (s + 1 == _segments.size());
+
+        if (lastSegment || (_segments[s+1].minerals >= amount))
+        {
+            // with no mineral workers left the amount is never gathered
+            if (rate == 0)
+            {
+                return segment.frame + NeverGathered;
+            }
+
+            // round up since we can't have the minerals part way through a frame
+            return segment.frame + (amount - segment.minerals + rate - 1) / rate;
+        }
+    }
+
+    return _segments.back().frame;
+}
+
+const FrameCountType IncomeModel::whenGasGathered(const ResourceCountType amount) const
+{
+    BOSS_ASSERT(_valid, "Income model used before being built");
+
+    for (size_t s(0); s < _segments.size(); ++s)
+    {
+        const IncomeSegment & segment = _segments[s];
+        const ResourceCountType rate = segment.gasWorkers * Constants::GPWPF;
+        const bool lastSegment = (s + 1 == _segments.size());
+
+        if (lastSegment || (_segments[s+1].gas >= amount))
+        {
+            if (rate == 0)
+            {
+                return segment.frame + NeverGathered;
+            }
+
+            return segment.frame + (amount - segment.gas + rate - 1) / rate;
+        }
+    }
+
+    return _segments.back().frame;
+}
+
+// returns the minerals gathered between the frame the model was built on and frame
+const ResourceCountType IncomeModel::getMineralsGathered(const FrameCountType frame) const
+{
+    BOSS_ASSERT(_valid, "Income model used before being built");
+
+    size_t s = _segments.size() - 1;
+    while (s > 0 && _segments[s].frame > frame)
+    {
+        --s;
+    }
+
+    return _segments[s].minerals + (frame - _segments[s].frame) * _segments[s].mineralWorkers * Constants::MPWPF;
+}
+
+const ResourceCountType IncomeModel::getGasGathered(const FrameCountType frame) const
+{
+    BOSS_ASSERT(_valid, "Income model used before being built");
+
+    size_t s = _segments.size() - 1;
+    while (s > 0 && _segments[s].frame > frame)
+    {
+        --s;
+    }
+
+    return _segments[s].gas + (frame - _segments[s].frame) * _segments[s].gasWorkers * Constants::GPWPF;
+}
+
+const size_t IncomeModel::getNumSegments() const
+{
+    return _segments.size();
+}
\ No newline at end of file
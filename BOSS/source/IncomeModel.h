@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Common.h"
+#include "UnitData.h"
+
+namespace BOSS
+{
+
+// a span of frames during which the number of mineral and gas workers doesn't change
+class IncomeSegment
+{
+public:
+
+    FrameCountType      frame;              // frame this segment starts on
+    ResourceCountType   minerals;           // minerals gathered between the model's start frame and this segment
+    ResourceCountType   gas;                // gas gathered between the model's start frame and this segment
+    UnitCountType       mineralWorkers;
+    UnitCountType       gasWorkers;
+
+    IncomeSegment(const FrameCountType f, const ResourceCountType m, const ResourceCountType g, const UnitCountType mw, const UnitCountType gw);
+};
+
+// Piecewise linear model of the future income of a GameState
+// Income only changes when a worker, a refinery or a terran building in progress finishes, so
+// from the current frame onward income is a handful of constant rate segments. The model is
+// built once per state and answers when an amount will have been gathered by scanning them.
+// The cache is never copied along with its GameState since a copied state is about to change.
+class IncomeModel
+{
+    std::vector<IncomeSegment>  _segments;
+    bool                        _valid;
+
+public:
+
+    IncomeModel();
+    IncomeModel(const IncomeModel & other);
+    IncomeModel & operator = (const IncomeModel & other);
+
+    bool                        isValid() const;
+    void                        invalidate();
+    void                        build(const UnitData & units, const FrameCountType currentFrame);
+
+    const FrameCountType        whenMineralsGathered(const ResourceCountType amount) const;
+    const FrameCountType        whenGasGathered(const ResourceCountType amount) const;
+    const ResourceCountType     getMineralsGathered(const FrameCountType frame) const;
+    const ResourceCountType     getGasGathered(const FrameCountType frame) const;
+    const size_t                getNumSegments() const;
+};
+
+}
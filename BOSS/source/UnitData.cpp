@@ -35,7 +35,7 @@ const FrameCountType UnitData::getWhenBuildingCanBuild(const ActionType & action
 }
 
 // only used for adding existing buildings from a BWAPI Game * object
-void UnitData::addCompletedBuilding(const ActionType & action, const FrameCountType timeUntilFree, const ActionType & constructing, const ActionType & addon, int numLarva)
+void UnitData::addCompletedBuilding(const ActionType & action, const FrameCountType timeUntilFree, const ActionType & constructing, const ActionType & addon, int numLarva, const FrameCountType larvaPhase)
 {
     _numUnits[action.ID()] += action.numProduced();
 
@@ -44,8 +44,9 @@ void UnitData::addCompletedBuilding(const ActionType & action, const FrameCountT
     // if it's an extractor
 	if (action.isRefinery()) 
 	{
-		// take those workers from minerals and put them into it
-		_mineralWorkers -= 3; _gasWorkers += 3;
+		// take those workers from minerals and put them into it, as many as there are
+		const UnitCountType transferred = std::min(_mineralWorkers, UnitCountType(3));
+		_mineralWorkers -= transferred; _gasWorkers += transferred;
 	}	
 
     // if it's a building that can produce units, add it to the building data
@@ -57,7 +58,7 @@ void UnitData::addCompletedBuilding(const ActionType & action, const FrameCountT
     // special case for hatcheries
     if (action.getRace() == Races::Zerg && action.isResourceDepot())
     {
-        _hatcheryData.addHatchery(numLarva);
+        _hatcheryData.addHatchery(numLarva, larvaPhase);
     }
 }
 
@@ -89,8 +90,9 @@ void UnitData::addCompletedAction(const ActionType & action, bool wasBuilt)
     // if it's an extractor
 	if (action.isRefinery()) 
 	{
-		// take those workers from minerals and put them into it
-		_mineralWorkers -= 3; _gasWorkers += 3;
+		// take those workers from minerals and put them into it, as many as there are
+		const UnitCountType transferred = std::min(_mineralWorkers, UnitCountType(3));
+		_mineralWorkers -= transferred; _gasWorkers += transferred;
 	}	
 
     // if it's a building that can produce units, add it to the building data
@@ -140,8 +142,9 @@ void UnitData::removeCompletedAction(const ActionType & action)
 	// if it's an extractor
 	if (action.isRefinery())
 	{
-		// take those workers from minerals and put them into it
-		_mineralWorkers += 3; _gasWorkers -= 3;
+		// put its workers back on minerals
+		const UnitCountType transferred = std::min(_gasWorkers, UnitCountType(3));
+		_mineralWorkers += transferred; _gasWorkers -= transferred;
 	}
 	BOSS_ASSERT(_mineralWorkers >= 0, "Can't have negative mineral workers");
 	BOSS_ASSERT(_gasWorkers >= 0, "Can't have negative gas workers");
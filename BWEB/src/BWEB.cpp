@@ -27,6 +27,13 @@ namespace BWEB
 
 		for (auto &unit : Broodwar->neutral()->getUnits())
 			addOverlap(unit->getTilePosition(), unit->getType().tileWidth(), unit->getType().tileHeight());
+
+		// Critters wander off, so they are not neutral obstacles.
+		for (auto &unit : Broodwar->getStaticNeutralUnits()) {
+			if (unit->getInitialType().canMove()) continue;
+			neutralsInLayer.insert(unit);
+			addToLayer(neutralGrid, unit->getInitialTilePosition(), unit->getInitialType().tileWidth(), unit->getInitialType().tileHeight());
+		}
 	}
 
 	void Map::onUnitDiscover(const Unit unit)
@@ -55,6 +62,9 @@ namespace BWEB
 
 	void Map::onUnitDestroy(const Unit unit)
 	{
+		if (unit && neutralsInLayer.erase(unit))
+			addToLayer(neutralGrid, unit->getInitialTilePosition(), unit->getInitialType().tileWidth(), unit->getInitialType().tileHeight(), -1);
+
 		if (!unit || !unit->getType().isBuilding() || unit->isFlying()) return;
 
 		const auto tile(unit->getTilePosition());
@@ -44,6 +44,17 @@ namespace BWEB
 		void findHiddenTechBlock(BWAPI::Player);
 		void findHiddenTechBlock(BWAPI::Race);
 		bool canAddBlock(TilePosition, int, int);
+
+		// Integral image of the tiles that no block may cover or border, for findBlocks().
+		// blockedSums[x][y] counts those tiles in the rectangle from (0, 0) up to but not including (x, y).
+		// Tiles only ever become blocked, so a stale image can only let through too many candidates.
+		int blockedSums[257][257] = {};
+		void updateBlockedSums();
+		bool mayAddBlock(TilePosition, int, int);
+
+		// Work done by the last findBlocks(), for benchmarking.
+		int blockCandidates = 0;		// (tile, size) pairs considered
+		int blockChecks = 0;			// calls to canAddBlock()
 		
 		void insertStartBlock(TilePosition, bool, bool);
 		void insertStartBlock(BWAPI::Player, TilePosition, bool, bool);
@@ -108,6 +119,19 @@ namespace BWEB
 		void addOverlap(TilePosition, int, int);
 		bool isPlaceable(UnitType, TilePosition);
 
+		// Occupancy layers for the overlaps* queries, so that each query is one array read.
+		// Each tile counts the things that cover it. Kept up to date as things are added and removed.
+		int stationGrid[256][256] = {};		// station depots and defenses
+		int blockGrid[256][256] = {};
+		int miningGrid[256][256] = {};		// tiles within 3 of a station's resource centroid
+		int neutralGrid[256][256] = {};		// static neutral units that have not been destroyed
+		int wallGrid[256][256] = {};		// wall pieces and defenses
+		set<Unit> neutralsInLayer;
+		void addToLayer(int (&grid)[256][256], TilePosition, int, int, int delta = 1);
+		void addStation(const Station&);
+		void addBlock(const Block&);
+		void addWall(const Wall&);
+
 		// Stations
 		void findStations();
 		set<TilePosition>& stationDefenses(BWAPI::Race, TilePosition, bool, bool);
@@ -4,78 +4,74 @@ namespace BWEB
 {
 	bool Map::overlapsStations(const TilePosition here)
 	{
-		for (auto& station : Stations())
-		{
-			const auto tile = station.BWEMBase()->Location();
-			if (here.x >= tile.x && here.x < tile.x + 4 && here.y >= tile.y && here.y < tile.y + 3) return true;
-			for (auto& defense : station.DefenseLocations())
-				if (here.x >= defense.x && here.x < defense.x + 2 && here.y >= defense.y && here.y < defense.y + 2) return true;
-		}
-		return false;
+		return here.isValid() && stationGrid[here.x][here.y] > 0;
 	}
 
 	bool Map::overlapsBlocks(const TilePosition here)
 	{
-		for (auto& block : Blocks())
-		{
-			if (here.x >= block.Location().x && here.x < block.Location().x + block.width() && here.y >= block.Location().y && here.y < block.Location().y + block.height()) return true;
-		}
-		return false;
+		return here.isValid() && blockGrid[here.x][here.y] > 0;
 	}
 
 	bool Map::overlapsMining(TilePosition here)
 	{
-		for (auto& station : Stations())
-			if (here.getDistance(TilePosition(station.ResourceCentroid())) < 3) return true;
-		return false;
+		return here.isValid() && miningGrid[here.x][here.y] > 0;
 	}
 
 	bool Map::overlapsNeutrals(const TilePosition here)
 	{
-		for (auto& m : mapBWEM.Minerals())
-		{
-			const auto tile = m->TopLeft();
-			if (here.x >= tile.x && here.x < tile.x + 2 && here.y >= tile.y && here.y < tile.y + 1) return true;
-		}
+		return here.isValid() && neutralGrid[here.x][here.y] > 0;
+	}
 
-		for (auto& g : mapBWEM.Geysers())
-		{
-			const auto tile = g->TopLeft();
-			if (here.x >= tile.x && here.x < tile.x + 4 && here.y >= tile.y && here.y < tile.y + 2) return true;
-		}
+	bool Map::overlapsWalls(const TilePosition here)
+	{
+		return here.isValid() && wallGrid[here.x][here.y] > 0;
+	}
 
-		for (auto& n : mapBWEM.StaticBuildings())
-		{
-			const auto tile = n->TopLeft();
-			if (here.x >= tile.x && here.x < tile.x + n->Type().tileWidth() && here.y >= tile.y && here.y < tile.y + n->Type().tileHeight()) return true;
+	void Map::addToLayer(int (&grid)[256][256], const TilePosition here, const int width, const int height, const int delta)
+	{
+		for (auto x = here.x; x < here.x + width; x++) {
+			for (auto y = here.y; y < here.y + height; y++) {
+				if (TilePosition(x, y).isValid())
+					grid[x][y] += delta;
+			}
 		}
+	}
 
-		for (auto& n : Broodwar->neutral()->getUnits())
-		{
-			const auto tile = n->getInitialTilePosition();
-			if (here.x >= tile.x && here.x < tile.x + n->getType().tileWidth() && here.y >= tile.y && here.y < tile.y + n->getType().tileHeight()) return true;
+	void Map::addStation(const Station& station)
+	{
+		stations.push_back(station);
+
+		addToLayer(stationGrid, station.BWEMBase()->Location(), 4, 3);
+		for (auto& defense : station.DefenseLocations())
+			addToLayer(stationGrid, defense, 2, 2);
+
+		const TilePosition centroid(station.ResourceCentroid());
+		for (auto x = centroid.x - 3; x <= centroid.x + 3; x++) {
+			for (auto y = centroid.y - 3; y <= centroid.y + 3; y++) {
+				const TilePosition t(x, y);
+				if (t.isValid() && t.getDistance(centroid) < 3)
+					miningGrid[x][y]++;
+			}
 		}
-		return false;
 	}
 
-	bool Map::overlapsWalls(const TilePosition here)
+	void Map::addBlock(const Block& block)
 	{
-		const auto x = here.x;
-		const auto y = here.y;
+		blocks.push_back(block);
+		addToLayer(blockGrid, block.Location(), block.width(), block.height());
+	}
 
-		for (auto& wall : getWalls())
-		{
-			for (const auto tile : wall.smallTiles())
-				if (x >= tile.x && x < tile.x + 2 && y >= tile.y && y < tile.y + 2) return true;
-			for (const auto tile : wall.mediumTiles())
-				if (x >= tile.x && x < tile.x + 3 && y >= tile.y && y < tile.y + 2) return true;
-			for (const auto tile : wall.largeTiles())
-				if (x >= tile.x && x < tile.x + 4 && y >= tile.y && y < tile.y + 3) return true;
-
-			for (auto& defense : wall.getDefenses())
-				if (here.x >= defense.x && here.x < defense.x + 2 && here.y >= defense.y && here.y < defense.y + 2) return true;
-		}
-		return false;
+	// Defenses are added to the layer by addToWall().
+	void Map::addWall(const Wall& wall)
+	{
+		walls.push_back(wall);
+
+		for (const auto tile : wall.smallTiles())
+			addToLayer(wallGrid, tile, 2, 2);
+		for (const auto tile : wall.mediumTiles())
+			addToLayer(wallGrid, tile, 3, 2);
+		for (const auto tile : wall.largeTiles())
+			addToLayer(wallGrid, tile, 4, 3);
 	}
 
 	bool Map::overlapsAnything(const TilePosition here, const int width, const int height, bool ignoreBlocks)
@@ -160,23 +160,63 @@ namespace BWEB
 			widths.insert(widths.end(), { 3, 6, 10 });
 		}
 
-		// Iterate every tile
-		for (int i = 20; i > 0; i--) {
-			for (int j = 20; j > 0; j--) {
-				for (auto& t : tilesByPathDist) {
+		// Widest first, then tallest first, then by distance
+		sort(widths.rbegin(), widths.rend());
+		sort(heights.rbegin(), heights.rend());
+
+		blockCandidates = 0;
+		blockChecks = 0;
+		auto stale = true;
+		for (auto i : widths) {
+			for (auto j : heights) {
+				if (stale) {
+					updateBlockedSums();
+					stale = false;
+				}
 
+				for (auto& t : tilesByPathDist) {
 					TilePosition tile(t.second);
-					if (find(heights.begin(), heights.end(), j) == heights.end() || find(widths.begin(), widths.end(), i) == widths.end())
+					blockCandidates++;
+					if (!mayAddBlock(tile, i, j))
 						continue;
 
+					blockChecks++;
 					if (canAddBlock(tile, i, j)) {
+						const auto count = blocks.size();
 						insertBlock(race, tile, i, j);
+						if (blocks.size() != count)
+							stale = true;
 					}
 				}
 			}
 		}
 	}
 
+	void Map::updateBlockedSums()
+	{
+		for (auto x = 0; x < Broodwar->mapWidth(); x++) {
+			for (auto y = 0; y < Broodwar->mapHeight(); y++) {
+				TilePosition t(x, y);
+				const auto blocked = !mapBWEM.GetTile(t).Buildable() || overlapGrid[x][y] > 0 || overlapsMining(t) ? 1 : 0;
+				blockedSums[x + 1][y + 1] = blockedSums[x][y + 1] + blockedSums[x + 1][y] - blockedSums[x][y] + blocked;
+			}
+		}
+	}
+
+	// The same test as canAddBlock(), as of the last updateBlockedSums(): a block and its 1 tile border
+	// must be on the map and clear.
+	bool Map::mayAddBlock(const TilePosition here, const int width, const int height)
+	{
+		const auto left = here.x - 1;
+		const auto top = here.y - 1;
+		const auto right = here.x + width + 1;
+		const auto bottom = here.y + height + 1;
+
+		if (left < 0 || top < 0 || right > Broodwar->mapWidth() || bottom > Broodwar->mapHeight())
+			return false;
+		return blockedSums[right][bottom] - blockedSums[left][bottom] - blockedSums[right][top] + blockedSums[left][top] == 0;
+	}
+
 	bool Map::canAddBlock(const TilePosition here, const int width, const int height)
 	{
 		// Check 4 corners before checking the rest
@@ -337,7 +377,7 @@ namespace BWEB
 			}
 			else return;
 		}
-		blocks.push_back(newBlock);
+		addBlock(newBlock);
 		addOverlap(here, width, height);
 	}
 
@@ -367,7 +407,7 @@ namespace BWEB
 					newBlock.insertSmall(here + TilePosition(6, 3));
 					newBlock.insertMedium(here + TilePosition(0, 3));
 					newBlock.insertMedium(here + TilePosition(3, 3));
-					blocks.push_back(newBlock);
+					addBlock(newBlock);
 				}
 				else
 				{
@@ -378,7 +418,7 @@ namespace BWEB
 					newBlock.insertSmall(here + TilePosition(6, 0));
 					newBlock.insertMedium(here + TilePosition(0, 0));
 					newBlock.insertMedium(here + TilePosition(3, 0));
-					blocks.push_back(newBlock);
+					addBlock(newBlock);
 				}
 			}
 			else
@@ -392,7 +432,7 @@ namespace BWEB
 					newBlock.insertSmall(here + TilePosition(0, 3));
 					newBlock.insertMedium(here + TilePosition(2, 3));
 					newBlock.insertMedium(here + TilePosition(5, 3));
-					blocks.push_back(newBlock);
+					addBlock(newBlock);
 				}
 				else
 				{
@@ -403,7 +443,7 @@ namespace BWEB
 					newBlock.insertSmall(here + TilePosition(0, 0));
 					newBlock.insertMedium(here + TilePosition(2, 0));
 					newBlock.insertMedium(here + TilePosition(5, 0));
-					blocks.push_back(newBlock);
+					addBlock(newBlock);
 				}
 			}
 		}
@@ -415,7 +455,7 @@ namespace BWEB
 			newBlock.insertSmall(here + TilePosition(4, 1));
 			newBlock.insertMedium(here + TilePosition(0, 3));
 			newBlock.insertMedium(here + TilePosition(3, 3));
-			blocks.push_back(newBlock);
+			addBlock(newBlock);
 		}
 	}
 
@@ -437,7 +477,7 @@ namespace BWEB
 			newBlock.insertSmall(here + TilePosition(0, 2));
 			newBlock.insertMedium(here + TilePosition(2, 0));
 			newBlock.insertMedium(here + TilePosition(2, 2));
-			blocks.push_back(newBlock);
+			addBlock(newBlock);
 		}
 	}
 
@@ -448,6 +488,7 @@ namespace BWEB
 			auto&  block = *it;
 			if (here.x >= block.Location().x && here.x < block.Location().x + block.width() && here.y >= block.Location().y && here.y < block.Location().y + block.height())
 			{
+				addToLayer(blockGrid, block.Location(), block.width(), block.height(), -1);
 				blocks.erase(it);
 				// Remove overlap
 				return;
@@ -47,7 +47,7 @@ namespace BWEB
 				for (auto& g : base.Geysers()) { geysers.insert(g->Unit()); }
 
 				const Station newStation(genCenter, stationDefenses(base.Location(), h, v), &base);
-				stations.push_back(newStation);
+				addStation(newStation);
 				addOverlap(base.Location(), 4, 3);
 
 				TilePosition start(genCenter);
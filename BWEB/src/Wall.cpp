@@ -81,7 +81,7 @@ namespace BWEB
 				addWallDefenses(defenses, newWall);
 
 			// Push wall into the vector
-			walls.push_back(newWall);
+			addWall(newWall);
 		}
 	}
 
@@ -370,6 +370,7 @@ namespace BWEB
 			currentWall[tileBest] = building;
 			wall.insertDefense(tileBest);
 			addOverlap(tileBest, 2, 2);
+			addToLayer(wallGrid, tileBest, 2, 2);
 		}
 
 		for (auto& defense : wall.getDefenses()) {
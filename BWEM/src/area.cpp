@@ -118,6 +118,18 @@ void Area::AddChokePoints(Area * pArea, vector<ChokePoint> * pChokePoints)
 
 
 vector<int> Area::ComputeDistances(const ChokePoint * pStartCP, const vector<const ChokePoint *> & TargetCPs) const
+{
+	vector<int> TileDist(GetMap()->Size().x * GetMap()->Size().y, 0);
+	vector<bool> TileMarked(GetMap()->Size().x * GetMap()->Size().y, false);
+
+	return ComputeDistances(pStartCP, TargetCPs, TileDist, TileMarked);
+}
+
+
+// Same as above, with the scratch grids supplied by the caller, who can reuse them for several calls.
+// They must be map sized, all 0 and false. They are left that way.
+vector<int> Area::ComputeDistances(const ChokePoint * pStartCP, const vector<const ChokePoint *> & TargetCPs,
+								   vector<int> & TileDist, vector<bool> & TileMarked) const
 {
 	bwem_assert(!contains(TargetCPs, pStartCP));
 
@@ -131,18 +143,24 @@ vector<int> Area::ComputeDistances(const ChokePoint * pStartCP, const vector<con
 								[this](const Tile & tile, TilePosition) { return tile.AreaId() == Id(); },	// findCond
 								[](const Tile &,          TilePosition) { return true; }));					// visitCond
 
-	return ComputeDistances(start, Targets);
+	return ComputeDistances(start, Targets, TileDist, TileMarked);
 }
 
 
 // Returns Distances such that Distances[i] == ground_distance(start, Targets[i]) in pixels
 // Note: same algorithm than Graph::ComputeDistances (derived from Dijkstra)
-vector<int> Area::ComputeDistances(TilePosition start, const vector<TilePosition> & Targets) const
+// The tentative distances and the marks are kept in TileDist and TileMarked rather than in the Tiles, so that
+// several Areas can compute their distances at the same time (see Graph::ComputeChokePointDistanceMatrix).
+// Only the touched tiles are reset at the end, so the grids are cheap to reuse.
+vector<int> Area::ComputeDistances(TilePosition start, const vector<TilePosition> & Targets,
+								   vector<int> & TileDist, vector<bool> & TileMarked) const
 {
 	const Map * pMap = GetMap();
 	vector<int> Distances(Targets.size());
 
-	Tile::UnmarkAll();
+	// TileDist is like Tile::InternalData(): 0 unless in ToVisit
+	auto index = [pMap](TilePosition t) { return t.y * pMap->Size().x + t.x; };
+	vector<int> Touched(1, index(start));
 
 	multimap<int, TilePosition> ToVisit;	// a priority queue holding the tiles to visit ordered by their distance to start.
 	ToVisit.emplace(0, start);
@@ -152,11 +170,10 @@ vector<int> Area::ComputeDistances(TilePosition start, const vector<TilePosition
 	{
 		int currentDist = ToVisit.begin()->first;
 		TilePosition current = ToVisit.begin()->second;
-		const Tile & currentTile = pMap->GetTile(current, check_t::no_check);
-		bwem_assert(currentTile.InternalData() == currentDist);
+		bwem_assert(TileDist[index(current)] == currentDist);
 		ToVisit.erase(ToVisit.begin());
-		currentTile.SetInternalData(0);										// resets Tile::m_internalData for future usage
-		currentTile.SetMarked();
+		TileDist[index(current)] = 0;
+		TileMarked[index(current)] = true;
 
 		for (int i = 0 ; i < (int)Targets.size() ; ++i)
 			if (current == Targets[i])
@@ -177,28 +194,28 @@ vector<int> Area::ComputeDistances(TilePosition start, const vector<TilePosition
 			if (pMap->Valid(next))
 			{
 				const Tile & nextTile = pMap->GetTile(next, check_t::no_check); 
-				if (!nextTile.Marked())
+				int & nextDist = TileDist[index(next)];
+				if (!TileMarked[index(next)])
 				{
-					if (nextTile.InternalData())	// next already in ToVisit
+					if (nextDist)	// next already in ToVisit
 					{
-						if (newNextDist < nextTile.InternalData())		// nextNewDist < nextOldDist
+						if (newNextDist < nextDist)		// nextNewDist < nextOldDist
 						{	// To update next's distance, we need to remove-insert it from ToVisit:
-							auto range = ToVisit.equal_range(nextTile.InternalData());
+							auto range = ToVisit.equal_range(nextDist);
 							auto iNext = find_if(range.first, range.second, [next]
 								(const pair<int, TilePosition> & e) { return e.second == next; });
 							bwem_assert(iNext != range.second);
 
 							ToVisit.erase(iNext);
-							nextTile.SetInternalData(newNextDist);
-						//	nextTile.SetPtr(const_cast<Tile *>(&currentTile));		// note: we won't use this backward trace
+							nextDist = newNextDist;
 							ToVisit.emplace(newNextDist, next);
 						}
 					}
 					else if ((nextTile.AreaId() == Id()) || (nextTile.AreaId() == -1))
 					{
-						nextTile.SetInternalData(newNextDist);
-					//	nextTile.SetPtr(const_cast<Tile *>(&currentTile));			// note: we won't use this backward trace
+						nextDist = newNextDist;
 						ToVisit.emplace(newNextDist, next);
+						Touched.push_back(index(next));
 					}
 				}
 			}
@@ -207,9 +224,11 @@ vector<int> Area::ComputeDistances(TilePosition start, const vector<TilePosition
 
 	bwem_assert(!remainingTargets);
 
-	// Reset Tile::m_internalData for future usage
-	for (auto e : ToVisit)
-		pMap->GetTile(e.second, check_t::no_check).SetInternalData(0);	
+	for (int i : Touched)
+	{
+		TileDist[i] = 0;
+		TileMarked[i] = false;
+	}
 	
 	return Distances;
 }
@@ -249,11 +268,11 @@ void Area::PostCollectInformation()
 
 // Calculates the score >= 0 corresponding to the placement of a Base Command Center at 'location'.
 // The more there are ressources nearby, the higher the score is.
-// The function assumes the distance to the nearby ressources has already been computed (in InternalData()) for each tile around.
-// The job is therefore made easier : just need to sum the InternalData() values.
+// The function assumes the distance to the nearby ressources has already been computed (in Field) for each tile around.
+// The job is therefore made easier : just need to sum the Field values.
 // Returns -1 if the location is impossible.
 
-int Area::ComputeBaseLocationScore(TilePosition location) const
+int Area::ComputeBaseLocationScore(TilePosition location, const vector<int> & Field) const
 {
 	const Map * pMap = GetMap();
 	const TilePosition dimCC = UnitType(Terran_Command_Center).tileSize();
@@ -262,14 +281,16 @@ int Area::ComputeBaseLocationScore(TilePosition location) const
 	for (int dy = 0 ; dy < dimCC.y ; ++dy)
 	for (int dx = 0 ; dx < dimCC.x ; ++dx)
 	{
-		const Tile & tile = pMap->GetTile(location + TilePosition(dx, dy), check_t::no_check);
+		const TilePosition t = location + TilePosition(dx, dy);
+		const Tile & tile = pMap->GetTile(t, check_t::no_check);
 		if (!tile.Buildable()) return -1;
-		if (tile.InternalData() == -1) return -1;		// The special value InternalData() == -1 means there is some ressource at maximum 3 tiles, which Starcraft rules forbid.
+		if (tile.AreaId() != Id()) return -1;			// checked before reading Field, which only covers this Area's bounding box
+		const int field = Field[BoundingBoxIndex(t)];
+		if (field == -1) return -1;						// The special value -1 means there is some ressource at maximum 3 tiles, which Starcraft rules forbid.
 												// Unfortunately, this is guaranteed only for the ressources in this Area, which is the very reason of ValidateBaseLocation
-		if (tile.AreaId() != Id()) return -1;
 		if (tile.GetNeutral() && tile.GetNeutral()->IsStaticBuilding()) return -1;
 
-		sumScore += tile.InternalData();
+		sumScore += field;
 	}
 
 	return sumScore;
@@ -317,12 +338,21 @@ bool Area::ValidateBaseLocation(TilePosition location, vector<Mineral *> & Block
 // The algorithm repeatedly searches the best possible location L (near ressources)
 // When it finds one, the nearby ressources are assigned to L, which makes the remaining ressources decrease.
 // This causes the algorithm to always terminate due to the lack of remaining ressources.
-// To efficiently compute the distances to the ressources, with use Potiential Fields in the InternalData() value of the Tiles.
+// To efficiently compute the distances to the ressources, with use Potiential Fields in Field.
+// Field takes the place of Tile::InternalData(), so that several Areas can create their Bases at the same time.
+// It only covers this Area's bounding box, which holds every Tile that can score or be part of a Base location.
 void Area::CreateBases()
 {
 	const TilePosition dimCC = UnitType(Terran_Command_Center).tileSize();
 	const Map * pMap = GetMap();
 
+	// An Area with no Tile keeps its initial bounding box (TopLeft at INT_MAX, BottomRight at INT_MIN),
+	// whose size would overflow. No Base location can be found in it anyway.
+	if (TopLeft().x > BottomRight().x) return;
+
+	vector<int> Field((BottomRight().x - TopLeft().x + 1) * (BottomRight().y - TopLeft().y + 1), 0);
+	auto field = [this, &Field](TilePosition t) -> int & { return Field[BoundingBoxIndex(t)]; };
+
 
 	// Initialize the RemainingRessources with all the Minerals and Geysers in this Area satisfying some conditions:
 	vector<Ressource *> RemainingRessources;
@@ -360,7 +390,7 @@ void Area::CreateBases()
 					int dist = (distToRectangle(center(t), r->TopLeft(), r->Size())+16)/32;
 					int score = max(max_tiles_between_CommandCenter_and_ressources + 3 - dist, 0);
 					if (r->IsGeyser()) score *= 3;		// somewhat compensates for Geyser alone vs the several Minerals
-					if (tile.AreaId() == Id()) tile.SetInternalData(tile.InternalData() + score);	// note the additive effect (assume tile.InternalData() is 0 at the begining)
+					if (tile.AreaId() == Id()) field(t) += score;	// note the additive effect (assume field(t) is 0 at the begining)
 				}
 			}
 
@@ -370,8 +400,8 @@ void Area::CreateBases()
 			for (int dx = -3 ; dx < r->Size().x + 3 ; ++dx)
 			{
 				TilePosition t = r->TopLeft() + TilePosition(dx, dy);
-				if (pMap->Valid(t))
-					pMap->GetTile(t, check_t::no_check).SetInternalData(-1);
+				if (InBoundingBox(t))
+					field(t) = -1;
 			}
 
 
@@ -383,7 +413,7 @@ void Area::CreateBases()
 		for (int y = topLeftSearchBoundingBox.y ; y <= bottomRightSearchBoundingBox.y ; ++y)
 		for (int x = topLeftSearchBoundingBox.x ; x <= bottomRightSearchBoundingBox.x ; ++x)
 		{
-			int score = ComputeBaseLocationScore(TilePosition(x, y));
+			int score = ComputeBaseLocationScore(TilePosition(x, y), Field);
 			if (score > bestScore)
 				if (ValidateBaseLocation(TilePosition(x, y), BlockingMinerals))
 				{
@@ -392,13 +422,13 @@ void Area::CreateBases()
 				}
 		}
 
-		// 5) Clear Tile::m_internalData (required due to our use of Potential Fields: see comments in 2))
+		// 5) Clear Field (required due to our use of Potential Fields: see comments in 2))
 		for (const Ressource * r : RemainingRessources)
 			for (int dy = -dimCC.y-max_tiles_between_CommandCenter_and_ressources ; dy < r->Size().y + dimCC.y+max_tiles_between_CommandCenter_and_ressources ; ++dy)
 			for (int dx = -dimCC.x-max_tiles_between_CommandCenter_and_ressources ; dx < r->Size().x + dimCC.x+max_tiles_between_CommandCenter_and_ressources ; ++dx)
 			{
 				TilePosition t = r->TopLeft() + TilePosition(dx, dy);
-				if (pMap->Valid(t)) pMap->GetTile(t, check_t::no_check).SetInternalData(0);
+				if (InBoundingBox(t)) field(t) = 0;
 			}
 
 		if (!bestScore) break;
@@ -145,6 +145,8 @@ public:
 	void							OnMineralDestroyed(const Mineral * pMineral);
 	void							PostCollectInformation();
 	std::vector<int>				ComputeDistances(const ChokePoint * pStartCP, const std::vector<const ChokePoint *> & TargetCPs) const;
+	std::vector<int>				ComputeDistances(const ChokePoint * pStartCP, const std::vector<const ChokePoint *> & TargetCPs,
+													 std::vector<int> & TileDist, std::vector<bool> & TileMarked) const;
 	void							UpdateAccessibleNeighbours();
 	void							SetGroupId(groupId gid)	{ bwem_assert(gid >= 1); m_groupId = gid; }
 	void							CreateBases();
@@ -154,9 +156,14 @@ private:
 	const detail::Graph *			GetGraph() const		{ return m_pGraph; }
 	detail::Graph *					GetGraph()				{ return m_pGraph; }
 
-	int								ComputeBaseLocationScore(BWAPI::TilePosition location) const;
+	int								ComputeBaseLocationScore(BWAPI::TilePosition location, const std::vector<int> & Field) const;
 	bool							ValidateBaseLocation(BWAPI::TilePosition location, std::vector<Mineral *> & BlockingMinerals) const;
-	std::vector<int>				ComputeDistances(BWAPI::TilePosition start, const std::vector<BWAPI::TilePosition> & Targets) const;
+	std::vector<int>				ComputeDistances(BWAPI::TilePosition start, const std::vector<BWAPI::TilePosition> & Targets,
+													 std::vector<int> & TileDist, std::vector<bool> & TileMarked) const;
+
+	// Grids covering only this Area's bounding box (see CreateBases): whether t is in it, and t's index.
+	bool							InBoundingBox(BWAPI::TilePosition t) const	{ return (t.x >= m_topLeft.x) && (t.x <= m_bottomRight.x) && (t.y >= m_topLeft.y) && (t.y <= m_bottomRight.y); }
+	int								BoundingBoxIndex(BWAPI::TilePosition t) const	{ return (t.y - m_topLeft.y) * (m_bottomRight.x - m_topLeft.x + 1) + (t.x - m_topLeft.x); }
 
 	detail::Graph * const			m_pGraph;
 	id								m_id;
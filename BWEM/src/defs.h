@@ -37,6 +37,9 @@ namespace detail
 #define BWEM_USE_MAP_PRINTER 0	// enable(1) or disable(0) the compilation of mapPrinter.cpp
 								// mapPrinter.h provides optional utils that require the EasyBMP Library (windows).
 
+#define BWEM_CHECK_TEMP_AREAS 0	// enable(1) or disable(0) the check of MapImpl::ComputeTempAreas against its former version.
+								// Both versions run on each map, and their times are printed.
+
 
 class Exception : public std::runtime_error
 {
@@ -222,11 +222,13 @@ void Graph::SetPath(const ChokePoint * cpA, const ChokePoint * cpB, const CPPath
 // which effectively computes the distances from one starting ChokePoint, using Dijkstra's algorithm.
 // If Context == Area, Dijkstra's algorithm works on the Tiles inside one Area.
 // If Context == Graph, Dijkstra's algorithm works on the GetChokePoints between the AreaS.
+// If pDistances is given, it holds the results of pContext->ComputeDistances, computed beforehand (see chokePointDistances).
 template<class Context>
-void Graph::ComputeChokePointDistances(const Context * pContext)
+void Graph::ComputeChokePointDistances(const Context * pContext, const vector<vector<int>> * pDistances)
 {
 ///	multimap<int, vector<WalkPosition>> trace;
 
+	int iStart = 0;
 	for (const ChokePoint * pStart : pContext->ChokePoints())
 	{
 		vector<const ChokePoint *> Targets;
@@ -236,7 +238,7 @@ void Graph::ComputeChokePointDistances(const Context * pContext)
 			Targets.push_back(cp);
 		}
 
-		auto DistanceToTargets = pContext->ComputeDistances(pStart, Targets);
+		auto DistanceToTargets = pDistances ? (*pDistances)[iStart++] : pContext->ComputeDistances(pStart, Targets);
 
 		for (int i = 0 ; i < (int)Targets.size() ; ++i)
 		{
@@ -270,8 +272,34 @@ void Graph::ComputeChokePointDistances(const Context * pContext)
 
 }
 
-template void Graph::ComputeChokePointDistances<Graph>(const Graph * pContext);
-template void Graph::ComputeChokePointDistances<Area>(const Area * pContext);
+template void Graph::ComputeChokePointDistances<Graph>(const Graph * pContext, const vector<vector<int>> * pDistances);
+template void Graph::ComputeChokePointDistances<Area>(const Area * pContext, const vector<vector<int>> * pDistances);
+
+
+// The results of pArea->ComputeDistances for each starting ChokePoint, in the order used by ComputeChokePointDistances.
+// Only reads the Map, so this can be called for several Areas at the same time.
+// The scratch grids are allocated once for the Area, ComputeDistances leaves them clear for the next call.
+static vector<vector<int>> chokePointDistances(const Area * pArea)
+{
+	const int mapTiles = pArea->GetMap()->Size().x * pArea->GetMap()->Size().y;
+	vector<int> TileDist(mapTiles, 0);
+	vector<bool> TileMarked(mapTiles, false);
+
+	vector<vector<int>> Distances;
+	for (const ChokePoint * pStart : pArea->ChokePoints())
+	{
+		vector<const ChokePoint *> Targets;
+		for (const ChokePoint * cp : pArea->ChokePoints())
+		{
+			if (cp == pStart) break;
+			Targets.push_back(cp);
+		}
+
+		Distances.push_back(pArea->ComputeDistances(pStart, Targets, TileDist, TileMarked));
+	}
+
+	return Distances;
+}
 
 
 void Graph::ComputeChokePointDistanceMatrix()
@@ -288,8 +316,14 @@ void Graph::ComputeChokePointDistanceMatrix()
 		line.resize(m_ChokePointList.size());
 
 	// 2) Compute distances inside each Area
-	for (const Area & area : Areas())
-		ComputeChokePointDistances(&area);
+	//    The Areas are searched concurrently, but their results are recorded one Area after the other, in order,
+	//    so that ties between equal distances are broken as in a serial computation.
+	vector<vector<vector<int>>> DistancesByArea(Areas().size());
+	parallel_for((int)Areas().size(), GetMap()->InitializationThreads(), [this, &DistancesByArea](int i)
+		{ DistancesByArea[i] = chokePointDistances(&Areas()[i]); });
+
+	for (int i = 0 ; i < (int)Areas().size() ; ++i)
+		ComputeChokePointDistances(&Areas()[i], &DistancesByArea[i]);
 
 	// 3) Compute distances through connected Areas
 	ComputeChokePointDistances(this);
@@ -516,12 +550,12 @@ void Graph::CollectInformation()
 
 void Graph::CreateBases()
 {
+	// Each Area only places Bases near its own ressources, so the Areas can be processed concurrently.
+	parallel_for((int)m_Areas.size(), GetMap()->InitializationThreads(), [this](int i) { m_Areas[i].CreateBases(); });
+
 	m_baseCount = 0;
 	for (Area & area : m_Areas)
-	{
-		area.CreateBases();
 		m_baseCount += area.Bases().size();
-	}
 }
 
 	
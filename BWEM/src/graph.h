@@ -115,7 +115,7 @@ public:
 
 private:
 	template<class Context>
-	void								ComputeChokePointDistances(const Context * pContext);
+	void								ComputeChokePointDistances(const Context * pContext, const vector<vector<int>> * pDistances = nullptr);
 	vector<int>							ComputeDistances(const ChokePoint * pStartCP, const vector<const ChokePoint *> & TargetCPs) const;
 	void								SetDistance(const ChokePoint * cpA, const ChokePoint * cpB, int value);
 	void								UpdateGroupIds();
@@ -62,7 +62,9 @@ public:
 
 	// This has to be called before any other function is called.
 	// A good place to do this is in ExampleAIModule::onStart()
-	virtual void						Initialize() = 0;
+	// With threads > 1, the stages that work Area by Area (the distances between the ChokePoints inside each Area,
+	// and the Bases) are spread over that many threads. The result is the same whatever the number of threads.
+	virtual void						Initialize(int threads = 1) = 0;
 
 	// Will return true once Initialize() has been called.
 	bool								Initialized() const			{ return m_size != 0; }
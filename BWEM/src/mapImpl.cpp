@@ -12,6 +12,9 @@
 #include "neutral.h"
 #include "bwapiExt.h"
 #include "winutils.h"
+#if BWEM_CHECK_TEMP_AREAS
+#include <chrono>
+#endif
 
 
 using namespace BWAPI;
@@ -65,11 +68,13 @@ MapImpl::~MapImpl()
 }
 
 
-void MapImpl::Initialize()
+void MapImpl::Initialize(int threads)
 {
 	this->~MapImpl();
     new (this) MapImpl();
 
+	m_initializationThreads = max(threads, 1);
+
 ///	Timer overallTimer;
 ///	Timer timer;
 
@@ -355,6 +360,12 @@ void MapImpl::ProcessBlockingNeutrals()
 	for (auto & s : StaticBuildings())	Candidates.push_back(s.get());
 	for (auto & m : Minerals())			Candidates.push_back(m.get());
 
+	// Visited marks for the flood fills below, shared by all of them: a miniTile has been visited by
+	// the current fill iff its mark equals generation, so starting a new fill is just ++generation.
+	vector<int> VisitedGeneration(WalkSize().x * WalkSize().y, 0);
+	int generation = 0;
+	auto visitedMark = [&VisitedGeneration, this](WalkPosition w) -> int & { return VisitedGeneration[w.y * WalkSize().x + w.x]; };
+
 	for (Neutral * pCandidate : Candidates)
 		if (!pCandidate->NextStacked())		// in the case where several neutrals are stacked, we only consider the top one
 		{
@@ -372,24 +383,24 @@ void MapImpl::ProcessBlockingNeutrals()
 				WalkPosition door = Border.back(); Border.pop_back();
 				Doors.push_back(door);
 				vector<WalkPosition> ToVisit(1, door);
-				vector<WalkPosition> Visited(1, door);
+				visitedMark(door) = ++generation;
 				while (!ToVisit.empty())
 				{
 					WalkPosition current = ToVisit.back(); ToVisit.pop_back();
 					for (WalkPosition delta : {WalkPosition(0, -1), WalkPosition(-1, 0), WalkPosition(+1, 0), WalkPosition(0, +1)})
 					{
 						WalkPosition next = current + delta;
-						if (Valid(next) && !contains(Visited, next))
+						if (Valid(next) && (visitedMark(next) != generation))
 							if (GetMiniTile(next, check_t::no_check).Walkable())
 								if (!GetTile(TilePosition(next), check_t::no_check).GetNeutral())
 									if (adjoins8SomeLakeOrNeutral(next, this))
 									{
 										ToVisit.push_back(next);
-										Visited.push_back(next);
+										visitedMark(next) = generation;
 									}
 					}
 				}
-				really_remove_if(Border, [&Visited](WalkPosition w)	{ return contains(Visited, w); });
+				really_remove_if(Border, [&visitedMark, generation](WalkPosition w)	{ return visitedMark(w) == generation; });
 			}
 
 			// 3)  If at least 2 doors, find the true doors in Border: a true door is a door that gives onto an area big enough
@@ -398,24 +409,26 @@ void MapImpl::ProcessBlockingNeutrals()
 				for (WalkPosition door : Doors)
 				{
 					vector<WalkPosition> ToVisit(1, door);
-					vector<WalkPosition> Visited(1, door);
+					visitedMark(door) = ++generation;
+					size_t visitedCount = 1;
 					const size_t limit = pCandidate->IsStaticBuilding() ? 10 : 400;
-					while (!ToVisit.empty() && (Visited.size() < limit))
+					while (!ToVisit.empty() && (visitedCount < limit))
 					{
 						WalkPosition current = ToVisit.back(); ToVisit.pop_back();
 						for (WalkPosition delta : {WalkPosition(0, -1), WalkPosition(-1, 0), WalkPosition(+1, 0), WalkPosition(0, +1)})
 						{
 							WalkPosition next = current + delta;
-							if (Valid(next) && !contains(Visited, next))
+							if (Valid(next) && (visitedMark(next) != generation))
 								if (GetMiniTile(next, check_t::no_check).Walkable())
 									if (!GetTile(TilePosition(next), check_t::no_check).GetNeutral())
 									{
 										ToVisit.push_back(next);
-										Visited.push_back(next);
+										visitedMark(next) = generation;
+										++visitedCount;
 									}
 						}
 					}
-					if (Visited.size() >= limit) TrueDoors.push_back(door);
+					if (visitedCount >= limit) TrueDoors.push_back(door);
 				}
 
 			// 4)  If at least 2 true doors, pCandidate is a blocking static building
@@ -489,6 +502,10 @@ void MapImpl::ComputeAreas()
 {
 	vector<pair<WalkPosition, MiniTile *>> MiniTilesByDescendingAltitude = SortMiniTiles();
 
+#if BWEM_CHECK_TEMP_AREAS
+	CheckTempAreas(MiniTilesByDescendingAltitude);
+#endif
+
 	vector<TempAreaInfo> TempAreaList = ComputeTempAreas(MiniTilesByDescendingAltitude);
 
 	CreateAreas(TempAreaList);
@@ -516,7 +533,22 @@ vector<pair<WalkPosition, MiniTile *>> MapImpl::SortMiniTiles()
 }
 
 
-static pair<Area::id, Area::id> findNeighboringAreas(WalkPosition p, const MapImpl * pMap)
+// While the temp areas are computed, merged areas are not relabeled: a MiniTile keeps the id it was given,
+// and Representative[id] leads to the id of the area it now belongs to (the absorbing one).
+// Returns that id, halving the path on the way.
+static Area::id findRepresentative(vector<Area::id> & Representative, Area::id id)
+{
+	while (Representative[id] != id)
+	{
+		Representative[id] = Representative[Representative[id]];
+		id = Representative[id];
+	}
+
+	return id;
+}
+
+
+static pair<Area::id, Area::id> findNeighboringAreas(WalkPosition p, const MapImpl * pMap, vector<Area::id> & Representative)
 {
 	pair<Area::id, Area::id> result(0, 0);
 
@@ -524,6 +556,7 @@ static pair<Area::id, Area::id> findNeighboringAreas(WalkPosition p, const MapIm
 		if (pMap->Valid(p + delta))
 		{
 			Area::id areaId = pMap->GetMiniTile(p + delta, check_t::no_check).AreaId();
+			if (areaId > 0) areaId = findRepresentative(Representative, areaId);
 			if (areaId > 0)
 				if (!result.first) result.first = areaId;
 				else if (result.first != areaId)
@@ -535,10 +568,11 @@ static pair<Area::id, Area::id> findNeighboringAreas(WalkPosition p, const MapIm
 }
 
 
+// Outside of chooseNeighboringArea only so that CheckTempAreas can run ComputeTempAreas twice from the same counters.
+static map<pair<Area::id, Area::id>, int> map_AreaPair_counter;
+
 static Area::id chooseNeighboringArea(Area::id a, Area::id b)
 {
-	static map<pair<Area::id, Area::id>, int> map_AreaPair_counter;
-
 	if (a > b) swap(a, b);
 	return (map_AreaPair_counter[make_pair(a, b)]++ % 2 == 0) ? a : b;
 }
@@ -547,14 +581,93 @@ static Area::id chooseNeighboringArea(Area::id a, Area::id b)
 vector<TempAreaInfo> MapImpl::ComputeTempAreas(const vector<pair<WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude)
 {
 	vector<TempAreaInfo> TempAreaList(1);		// TempAreaList[0] left unused, as AreaIds are > 0
+	vector<Area::id> Representative(1, 0);		// see findRepresentative
+	for (const auto & Current : MiniTilesByDescendingAltitude)
+	{
+		const WalkPosition pos = Current.first;
+		MiniTile * cur = Current.second;
+		
+		pair<Area::id, Area::id> neighboringAreas = findNeighboringAreas(pos, this, Representative);
+		if (!neighboringAreas.first)			// no neighboring area : creates of a new area
+		{
+			Representative.push_back((Area::id)TempAreaList.size());
+			TempAreaList.emplace_back((Area::id)TempAreaList.size(), cur, pos);
+		}
+		else if (!neighboringAreas.second)		// one neighboring area : adds cur to the existing area
+		{
+			TempAreaList[neighboringAreas.first].Add(cur);
+		}
+		else									// two neighboring areas : adds cur to one of them  &  possible merging
+		{
+			Area::id smaller = neighboringAreas.first;
+			Area::id bigger = neighboringAreas.second;
+			if (TempAreaList[smaller].Size() > TempAreaList[bigger].Size()) swap(smaller, bigger);
+
+			// Condition for the neighboring areas to merge:
+			if ((TempAreaList[smaller].Size() < 80) ||
+				(TempAreaList[smaller].HighestAltitude() < 80) ||
+				(cur->Altitude() / (double)TempAreaList[bigger].HighestAltitude() >= 0.90) ||
+				(cur->Altitude() / (double)TempAreaList[smaller].HighestAltitude() >= 0.90) ||
+				any_of(StartingLocations().begin(), StartingLocations().end(), [&pos](const TilePosition & startingLoc)
+					{ return dist(TilePosition(pos), startingLoc + TilePosition(2, 1)) <= 3;}) ||
+				false
+				)
+			{
+				// adds cur to the absorbing area:
+				TempAreaList[bigger].Add(cur);
+
+				// merges the two neighboring areas (the MiniTiles of smaller are relabeled below):
+				Representative[smaller] = bigger;
+				TempAreaList[bigger].Merge(TempAreaList[smaller]);
+			}
+			else	// no merge : cur starts or continues the frontier between the two neighboring areas
+			{
+				// adds cur to the chosen Area:
+				TempAreaList[chooseNeighboringArea(smaller, bigger)].Add(cur);
+				m_RawFrontier.emplace_back(neighboringAreas, pos);
+			}
+		}	
+	}
+
+	// Relabels the MiniTiles of the merged areas, all at once
+	for (const auto & Current : MiniTilesByDescendingAltitude)
+	{
+		MiniTile * cur = Current.second;
+		const Area::id id = findRepresentative(Representative, cur->AreaId());
+		if (id != cur->AreaId()) cur->ReplaceAreaId(id);
+	}
+
+	for (auto & f : m_RawFrontier)
+	{
+		f.first.first = findRepresentative(Representative, f.first.first);
+		f.first.second = findRepresentative(Representative, f.first.second);
+	}
+
+	// Remove from the frontier obsolete positions
+	really_remove_if(m_RawFrontier, [](const pair<pair<Area::id, Area::id>, BWAPI::WalkPosition> & f)
+		{ return f.first.first == f.first.second; });
+
+	return TempAreaList;
+}
+
+
+#if BWEM_CHECK_TEMP_AREAS
+// ComputeTempAreas as it was before findRepresentative: each merge immediately relabels
+// the MiniTiles of the absorbed area, and the frontier, using ReplaceAreaIds.
+// Only kept to be checked against ComputeTempAreas (see CheckTempAreas).
+vector<TempAreaInfo> MapImpl::ComputeTempAreasByFloodFill(const vector<pair<WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude)
+{
+	vector<TempAreaInfo> TempAreaList(1);		// TempAreaList[0] left unused, as AreaIds are > 0
+	vector<Area::id> Representative(1, 0);		// stays the identity, as no MiniTile keeps the id of an absorbed area
 	for (const auto & Current : MiniTilesByDescendingAltitude)
 	{
 		const WalkPosition pos = Current.first;
 		MiniTile * cur = Current.second;
 		
-		pair<Area::id, Area::id> neighboringAreas = findNeighboringAreas(pos, this);
+		pair<Area::id, Area::id> neighboringAreas = findNeighboringAreas(pos, this, Representative);
 		if (!neighboringAreas.first)			// no neighboring area : creates of a new area
 		{
+			Representative.push_back((Area::id)TempAreaList.size());
 			TempAreaList.emplace_back((Area::id)TempAreaList.size(), cur, pos);
 		}
 		else if (!neighboringAreas.second)		// one neighboring area : adds cur to the existing area
@@ -601,6 +714,63 @@ vector<TempAreaInfo> MapImpl::ComputeTempAreas(const vector<pair<WalkPosition, M
 }
 
 
+// Runs ComputeTempAreasByFloodFill and ComputeTempAreas from the same state, and throws unless they give
+// the same temp areas, MiniTile area ids and raw frontier. Prints the time each of them took.
+// The MiniTiles, the frontier and the counters of chooseNeighboringArea are left as they were found.
+void MapImpl::CheckTempAreas(const vector<pair<WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude)
+{
+	bwem_assert_throw(m_RawFrontier.empty());
+
+	const auto AreaPairCounters = map_AreaPair_counter;
+	auto restore = [&]()
+	{
+		for (const auto & Current : MiniTilesByDescendingAltitude)
+			Current.second->ResetAreaId();
+		m_RawFrontier.clear();
+		map_AreaPair_counter = AreaPairCounters;
+	};
+
+	auto start = chrono::steady_clock::now();
+	const vector<TempAreaInfo> FloodFillList = ComputeTempAreasByFloodFill(MiniTilesByDescendingAltitude);
+	const double floodFillMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	vector<Area::id> FloodFillAreaIds;
+	FloodFillAreaIds.reserve(MiniTilesByDescendingAltitude.size());
+	for (const auto & Current : MiniTilesByDescendingAltitude)
+		FloodFillAreaIds.push_back(Current.second->AreaId());
+	const auto FloodFillFrontier = m_RawFrontier;
+	restore();
+
+	start = chrono::steady_clock::now();
+	const vector<TempAreaInfo> TempAreaList = ComputeTempAreas(MiniTilesByDescendingAltitude);
+	const double unionFindMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	bwem_assert_throw_plus(TempAreaList.size() == FloodFillList.size(), "different number of temp areas");
+	for (size_t i = 1 ; i < TempAreaList.size() ; ++i)
+	{
+		const TempAreaInfo & a = TempAreaList[i];
+		const TempAreaInfo & b = FloodFillList[i];
+		bwem_assert_throw_plus(a.Valid() == b.Valid(), "temp area " + to_string(i) + " merged in only one version");
+		if (a.Valid())
+			bwem_assert_throw_plus((a.Id() == b.Id()) && (a.Top() == b.Top()) && (a.Size() == b.Size()) && (a.HighestAltitude() == b.HighestAltitude()),
+									"temp area " + to_string(i) + " differs");
+	}
+
+	for (size_t i = 0 ; i < MiniTilesByDescendingAltitude.size() ; ++i)
+		bwem_assert_throw_plus(MiniTilesByDescendingAltitude[i].second->AreaId() == FloodFillAreaIds[i],
+								"different area id at miniTile " + to_string(MiniTilesByDescendingAltitude[i].first.x) + ", " + to_string(MiniTilesByDescendingAltitude[i].first.y));
+
+	bwem_assert_throw_plus(m_RawFrontier == FloodFillFrontier, "different raw frontiers");
+
+	bw << "ComputeTempAreas on " << bw->mapFileName() << ": " << MiniTilesByDescendingAltitude.size() << " miniTiles, "
+	   << TempAreaList.size() - 1 << " temp areas, " << m_RawFrontier.size() << " frontier positions. "
+	   << "Flood fill " << floodFillMs << " ms, union-find " << unionFindMs << " ms" << endl;
+
+	restore();
+}
+#endif
+
+
 // Initializes m_Graph with the valid and big enough areas in TempAreaList.
 void MapImpl::CreateAreas(const vector<TempAreaInfo> & TempAreaList)
 {
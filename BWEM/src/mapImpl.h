@@ -58,7 +58,10 @@ public:
 								MapImpl();
 								~MapImpl();
 
-	void						Initialize() override;
+	void						Initialize(int threads = 1) override;
+
+	// The threads argument of the last Initialize(), at least 1.
+	int							InitializationThreads() const							{ return m_initializationThreads; }
 
 	bool						AutomaticPathUpdate() const override					{ return m_automaticPathUpdate; }
 	void						EnableAutomaticPathAnalysis() const override			{ m_automaticPathUpdate = true; }
@@ -126,6 +129,10 @@ private:
 	vector<pair<BWAPI::WalkPosition, MiniTile *>>
 								SortMiniTiles();
 	vector<TempAreaInfo>		ComputeTempAreas(const vector<pair<BWAPI::WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude);
+#if BWEM_CHECK_TEMP_AREAS
+	vector<TempAreaInfo>		ComputeTempAreasByFloodFill(const vector<pair<BWAPI::WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude);
+	void						CheckTempAreas(const vector<pair<BWAPI::WalkPosition, MiniTile *>> & MiniTilesByDescendingAltitude);
+#endif
 	void						CreateAreas(const vector<TempAreaInfo> & TempAreaList);
 	void						SetAreaIdInTiles();
 	void						SetAreaIdInTile(BWAPI::TilePosition t);
@@ -134,6 +141,8 @@ private:
 
 	altitude_t							m_maxAltitude;
 
+	int									m_initializationThreads = 1;
+
 	mutable bool						m_automaticPathUpdate = false;
 
 	class Graph							m_Graph;
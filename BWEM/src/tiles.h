@@ -87,6 +87,9 @@ public:
 	void				SetAltitude(altitude_t a)	{ bwem_assert_debug_only(AltitudeMissing() && (a > 0)); m_altitude = a; }
 	bool				AreaIdMissing() const		{ return m_areaId == -1; }
 	void				SetAreaId(Area::id id)		{ bwem_assert(AreaIdMissing() && (id >= 1)); m_areaId = id; }
+#if BWEM_CHECK_TEMP_AREAS
+	void				ResetAreaId()				{ m_areaId = -1; }		// only used to run ComputeTempAreas twice (see MapImpl::ComputeAreas)
+#endif
 	void				ReplaceAreaId(Area::id id)	{ bwem_assert((m_areaId > 0) && ((id >= 1) || (id <= -2)) && (id != m_areaId)); m_areaId = id; }
 	void				SetBlocked()				{ bwem_assert(AreaIdMissing()); m_areaId = blockingCP; }
 	bool				Blocked() const				{ return m_areaId == blockingCP; }
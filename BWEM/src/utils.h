@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <limits>
 #include <fstream>
+#include <atomic>
+#include <thread>
 #include "defs.h"
 
 
@@ -177,6 +179,29 @@ inline void fast_erase(std::vector<T> & Vector, int i)
 }
 
 
+// Calls f(i) for each i in [0, n), using up to 'threads' threads, the calling one included.
+// Returns once all the calls are done. The calls may run in any order and at the same time,
+// so f(i) should only write to data that belongs to i.
+template<class F>
+inline void parallel_for(int n, int threads, F f)
+{
+	threads = std::min(threads, n);
+	if (threads <= 1)
+	{
+		for (int i = 0 ; i < n ; ++i) f(i);
+		return;
+	}
+
+	std::atomic<int> next(0);
+	auto work = [&next, n, &f]() { for (int i = next++ ; i < n ; i = next++) f(i); };
+
+	std::vector<std::thread> Workers;
+	for (int t = 1 ; t < threads ; ++t) Workers.emplace_back(work);
+	work();
+	for (auto & w : Workers) w.join();
+}
+
+
 struct compare2nd
 {
     template <typename T>
@@ -38,6 +38,10 @@ void Bases::countResources(BWAPI::Unit resource, int & minerals, int & gas) cons
 // Given a set of resources (mineral patches and geysers), find a base position nearby if possible.
 // This identifies the spot for the resource depot.
 // Return BWAPI::TilePositions::Invalid if no acceptable place is found.
+// All the work happens in a small window around the resources, (2 * BasePositionRange + 1) tiles square:
+// A ground distance search to find and order the candidate tiles, a table of which tiles can hold
+// a depot, and a table of scores. Scoring adds up the resources one at a time over the whole window,
+// which is a few simple array passes instead of a loop over the resources for every candidate.
 BWAPI::TilePosition Bases::findBasePosition(BWAPI::Unitset resources)
 {
 	UAB_ASSERT(resources.size() > 0, "no resources");
@@ -60,77 +64,141 @@ BWAPI::TilePosition Bases::findBasePosition(BWAPI::Unitset resources)
 
 	potentialBases.push_back(PotentialBase(left, right, top, bottom, centerOfResources));
 
-	DistanceMap distances(centerOfResources, BasePositionRange, false);
+	// The window. Window tile (i, j) is map tile origin + (i, j).
+	const int size = 2 * BasePositionRange + 1;
+	const BWAPI::TilePosition origin = centerOfResources - BWAPI::TilePosition(BasePositionRange, BasePositionRange);
 
-	int bestScore = 999999;               // smallest is best
-	BWAPI::TilePosition bestTile = BWAPI::TilePositions::Invalid;
+	// 1. Candidate tiles in order of ground distance from the center, up to BasePositionRange.
+	//    This visits tiles in the same order as a DistanceMap, so ties are broken the same way.
+	const int LegalActions = 4;
+	const int actionX[LegalActions] = { 1, -1, 0, 0 };
+	const int actionY[LegalActions] = { 0, 0, 1, -1 };
+
+	std::vector<short> dist(size * size, -1);
+	std::vector<BWAPI::TilePosition> sortedTiles;
+	sortedTiles.reserve(size * size);
 
-	for (BWAPI::TilePosition tile : distances.getSortedTiles())
+	dist[BasePositionRange * size + BasePositionRange] = 0;
+	sortedTiles.push_back(centerOfResources);
+
+	for (size_t i = 0; i < sortedTiles.size(); ++i)
 	{
-		// NOTE Every resource depot is the same size, 4x3 tiles.
-		if (MapTools::Instance().isBuildable(tile, BWAPI::UnitTypes::Protoss_Nexus))
+		const BWAPI::TilePosition tile = sortedTiles[i];
+		const int currentDist = dist[(tile.y - origin.y) * size + tile.x - origin.x];
+		if (currentDist >= BasePositionRange)
+		{
+			continue;
+		}
+
+		for (int a = 0; a < LegalActions; ++a)
 		{
-			int score = baseLocationScore(tile, resources);
-			if (score < bestScore)
+			const BWAPI::TilePosition next(tile.x + actionX[a], tile.y + actionY[a]);
+			const int index = (next.y - origin.y) * size + next.x - origin.x;
+			if (next.isValid() &&
+				dist[index] == -1 &&
+				MapTools::Instance().isTerrainWalkable(next))
 			{
-				bestScore = score;
-				bestTile = tile;
+				dist[index] = currentDist + 1;
+				sortedTiles.push_back(next);
 			}
 		}
 	}
 
-	return bestTile;
-}
-
-int Bases::baseLocationScore(const BWAPI::TilePosition & tile, BWAPI::Unitset resources) const
-{
-	int score = 0;
-
-	for (const BWAPI::Unit resource : resources)
+	// 2. Which window tiles can be the top left corner of a depot.
+	//    First the run of depot-buildable tiles starting at each tile and going right,
+	//    over an area big enough to cover a depot at any window tile.
+	const int runWidth = size + DepotTileWidth - 1;
+	const int runHeight = size + DepotTileHeight - 1;
+	std::vector<int> runRight(runWidth * runHeight, 0);
+	for (int j = 0; j < runHeight; ++j)
 	{
-		score += tilesBetweenBoxes
-			( tile
-			, tile + BWAPI::TilePosition(DepotTileWidth, DepotTileHeight)
-			, resource->getInitialTilePosition()
-			, resource->getInitialTilePosition() + BWAPI::TilePosition(2, 2)
-			);
+		int run = 0;
+		for (int i = runWidth - 1; i >= 0; --i)
+		{
+			const BWAPI::TilePosition tile(origin.x + i, origin.y + j);
+			if (tile.isValid() && MapTools::Instance().isBuildable(tile) && MapTools::Instance().isDepotBuildable(tile))
+			{
+				++run;
+			}
+			else
+			{
+				run = 0;
+			}
+			runRight[j * runWidth + i] = run;
+		}
 	}
 
-	return score;
-}
+	// 3. The score of each window tile: The sum of the distances from the depot to each resource.
+	//    The distance between two boxes is the larger of the gaps along x and along y,
+	//    and the gaps depend only on the column and only on the row respectively.
+	//    NOTE Every resource counts as 2x2 tiles, geysers included. That's how it has always been.
+	std::vector<int> score(size * size, 0);
+	std::vector<int> gapX(size);
+	std::vector<int> gapY(size);
+	for (const BWAPI::Unit resource : resources)
+	{
+		const BWAPI::TilePosition resourceTile = resource->getInitialTilePosition();
 
-// One-dimensional edge-to-edge distance between two tile rectangles.
-// Used to figure out distance from a resource depot location to a resource.
-int Bases::tilesBetweenBoxes
-	( const BWAPI::TilePosition & topLeftA
-	, const BWAPI::TilePosition & bottomRightA
-	, const BWAPI::TilePosition & topLeftB
-	, const BWAPI::TilePosition & bottomRightB
-	) const
-{
-	int leftDist = 0;
-	int rightDist = 0;
+		for (int i = 0; i < size; ++i)
+		{
+			gapX[i] = tilesBetween(origin.x + i, origin.x + i + DepotTileWidth, resourceTile.x, resourceTile.x + 2);
+			gapY[i] = tilesBetween(origin.y + i, origin.y + i + DepotTileHeight, resourceTile.y, resourceTile.y + 2);
+		}
 
-	if (topLeftB.x >= bottomRightA.x)
-	{
-		leftDist = topLeftB.x - bottomRightA.x;
+		for (int j = 0; j < size; ++j)
+		{
+			const int gy = gapY[j];
+			int * row = &score[j * size];
+			for (int i = 0; i < size; ++i)
+			{
+				row[i] += std::max(gapX[i], gy);
+			}
+		}
 	}
-	else if (topLeftA.x >= bottomRightB.x)
+
+	// 4. The best candidate in distance order. Smallest score is best.
+	int bestScore = 999999;
+	BWAPI::TilePosition bestTile = BWAPI::TilePositions::Invalid;
+
+	for (const BWAPI::TilePosition & tile : sortedTiles)
 	{
-		leftDist = topLeftA.x - bottomRightB.x;
+		const int i = tile.x - origin.x;
+		const int j = tile.y - origin.y;
+
+		// NOTE Every resource depot is the same size, 4x3 tiles.
+		bool buildable = true;
+		for (int dy = 0; dy < DepotTileHeight; ++dy)
+		{
+			if (runRight[(j + dy) * runWidth + i] < DepotTileWidth)
+			{
+				buildable = false;
+				break;
+			}
+		}
+
+		if (buildable && score[j * size + i] < bestScore)
+		{
+			bestScore = score[j * size + i];
+			bestTile = tile;
+		}
 	}
 
-	if (topLeftA.y >= bottomRightB.y)
+	return bestTile;
+}
+
+// One-dimensional edge-to-edge distance between two tile ranges [lowA, highA) and [lowB, highB).
+// Used to figure out distance from a resource depot location to a resource.
+int Bases::tilesBetween(int lowA, int highA, int lowB, int highB) const
+{
+	if (lowB >= highA)
 	{
-		rightDist = topLeftA.y - bottomRightB.y;
+		return lowB - highA;
 	}
-	else if (topLeftB.y >= bottomRightA.y)
+	if (lowA >= highB)
 	{
-		rightDist = topLeftB.y - bottomRightA.y;
+		return lowA - highB;
 	}
-
-	UAB_ASSERT(leftDist >= 0 && rightDist >= 0, "bad tile distance");
-	return std::max(leftDist, rightDist);
+	return 0;
 }
 
 // The two possible base positions are close enough together
@@ -51,12 +51,7 @@ namespace UAlbertaBot
 		void removeUsedResources(BWAPI::Unitset & resources, const Base & base) const;
 		void countResources(BWAPI::Unit resource, int & minerals, int & gas) const;
 		BWAPI::TilePosition findBasePosition(BWAPI::Unitset resources);
-		int baseLocationScore(const BWAPI::TilePosition & tile, BWAPI::Unitset resources) const;
-		int tilesBetweenBoxes
-			( const BWAPI::TilePosition & topLeftA
-			, const BWAPI::TilePosition & bottomRightA
-			, const BWAPI::TilePosition & topLeftB
-			, const BWAPI::TilePosition & bottomRightB) const;
+		int tilesBetween(int lowA, int highA, int lowB, int highB) const;
 
 		bool closeEnough(BWAPI::TilePosition a, BWAPI::TilePosition b);
 
@@ -14,6 +14,7 @@ BuildOrderItem::BuildOrderItem(MacroAct m, bool workerScoutBuilding)
 
 BuildOrderQueue::BuildOrderQueue()
 	: modified(false)
+	, changes(0)
 {
 }
 
@@ -21,6 +22,7 @@ void BuildOrderQueue::clearAll()
 {
 	queue.clear();
 	modified = true;
+	++changes;
 	Log().Debug() << "Cleared build queue";
 }
 
@@ -34,6 +36,7 @@ void BuildOrderQueue::dropStaticDefenses()
 		if (act.isBuilding() &&	UnitUtil::IsComingStaticDefense(act.getUnitType()))
 		{
 			it = queue.erase(it);
+			++changes;
 		}
 		else
 		{
@@ -46,6 +49,7 @@ void BuildOrderQueue::queueAsHighestPriority(MacroAct m, bool gasSteal)
 {
 	queue.push_back(BuildOrderItem(m, gasSteal));
 	modified = true;
+	++changes;
 	Log().Debug() << "Queued " << m << " at top of queue";
 }
 
@@ -53,6 +57,7 @@ void BuildOrderQueue::queueAsLowestPriority(MacroAct m)
 {
 	queue.push_front(BuildOrderItem(m));
 	modified = true;
+	++changes;
 	Log().Debug() << "Queued " << m << " at bottom of queue";
 }
 
@@ -60,12 +65,14 @@ void BuildOrderQueue::removeHighestPriorityItem()
 {
 	queue.pop_back();
 	modified = true;
+	++changes;
 	Log().Debug() << "Removed highest priority item";
 }
 
 void BuildOrderQueue::doneWithHighestPriorityItem()
 {
 	queue.pop_back();
+	++changes;
 }
 
 void BuildOrderQueue::pullToTop(size_t i)
@@ -76,6 +83,7 @@ void BuildOrderQueue::pullToTop(size_t i)
 
 	BuildOrderItem item = queue[i];								// copy it
 	queue.erase(queue.begin() + i);
+	++changes;
 	queueAsHighestPriority(item.macroAct, item.isWorkerScoutBuilding);		// this sets modified = true
 }
 
@@ -19,6 +19,7 @@ class BuildOrderQueue
 {
     std::deque< BuildOrderItem > queue;		// highest priority item is in the back
 	bool modified;							// so ProductionManager can detect changes made behind its back
+	int changes;							// count of all changes, including those that don't set `modified`
 
 public:
 
@@ -26,6 +27,7 @@ public:
 
 	bool isModified() const { return modified; };
 	void resetModified() { modified = false; };
+	int getChanges() const { return changes; };
 
     void clearAll();											// clear the entire build order queue
 	void dropStaticDefenses();									// delete any static defense buildings
@@ -7,11 +7,21 @@
 
 using namespace UAlbertaBot;
 
+namespace
+{
+	// Only prefetch on frames with at least this much time left.
+	const int MinMillisecondsToPrefetch = 10;
+
+	// Find a fresh location for a prefetched site this old, since power and blocks may have changed.
+	const int PrefetchedSiteLifetime = 10 * 24;
+}
+
 BuildingManager::BuildingManager()
     : _reservedMinerals(0)
     , _reservedGas(0)
 	, _dontPlaceUntil(0)
 	, _stalledForLackOfSpace(false)
+	, _prefetchRetryFrame(0)
 {
 }
 
@@ -110,6 +120,7 @@ void BuildingManager::assignWorkersToUnassignedBuildings()
 
         // reserve this building's space
         BuildingPlacer::Instance().reserveTiles(b.finalPosition,b.type.tileWidth(),b.type.tileHeight());
+		claimPrefetchedSite(b);
 
         b.status = BuildingStatus::Assigned;
 		// BWAPI::Broodwar->printf("assigned and placed building %s", b.type.getName().c_str());
@@ -701,10 +712,47 @@ BWAPI::TilePosition BuildingManager::getBuildingLocation(const Building & b)
 	    b.finalPosition.x > 0)
 	    return b.finalPosition;
 
+	int site = findPrefetchedSite(b);
+	if (site >= 0)
+	{
+		return _prefetchedSites[site].tile;
+	}
+
+	return computeBuildingLocation(b);
+}
+
+// Do the work of placing a building that does not have a location yet.
+// If BWEB could not place it, log it and put off further placement if the fallback failed too.
+BWAPI::TilePosition BuildingManager::computeBuildingLocation(const Building & b)
+{
+	bool usedFallback = false;
+	BWAPI::TilePosition tile = findBuildingLocation(b, usedFallback);
+
+	if (usedFallback)
+	{
+		if (tile == BWAPI::TilePositions::None)
+		{
+			Log().Get() << "Failed to place " << b.type;
+			_dontPlaceUntil = BWAPI::Broodwar->getFrameCount() + 100;
+		}
+		else
+		{
+			Log().Get() << "Failed to place " << b.type << " with BWEB";
+			_dontPlaceUntil = 0;
+		}
+	}
+
+	return tile;
+}
+
+// Search for a location for a building, with no side effects, so that prefetching can use it.
+// usedFallback is set if BWEB could not place the building and the BuildingPlacer search ran.
+BWAPI::TilePosition BuildingManager::findBuildingLocation(const Building & b, bool & usedFallback) const
+{
 	// gas steal
 	if (b.isWorkerScoutBuilding && b.type == BWAPI::UnitTypes::Protoss_Assimilator)
     {
-        BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+        BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
         UAB_ASSERT(enemyBaseLocation,"Should find enemy base before gas steal");
         UAB_ASSERT(enemyBaseLocation->getGeysers().size() > 0,"Should have spotted an enemy geyser");
 
@@ -721,7 +769,7 @@ BWAPI::TilePosition BuildingManager::getBuildingLocation(const Building & b)
 
 	if (b.type.isResourceDepot())
 	{
-		BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+		BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
 		if (b.macroLocation == MacroLocation::Natural && natural)
 		{
 			return natural->getTilePosition();
@@ -774,20 +822,151 @@ BWAPI::TilePosition BuildingManager::getBuildingLocation(const Building & b)
 	}
 
 	// Get a position within our region.
-	BWAPI::TilePosition tile = BuildingPlacer::Instance().getBuildLocationNear(b, distance);
+	usedFallback = true;
+	return BuildingPlacer::Instance().getBuildLocationNear(b, distance);
+}
+
+// Buildings placed by BuildingPlacer can be prefetched.
+// Refineries and expansions have their own fixed spots, and are cheap to place.
+bool BuildingManager::canPrefetch(const Building & b) const
+{
+	return
+		!b.isWorkerScoutBuilding &&
+		!b.type.isRefinery() &&
+		(!b.type.isResourceDepot() || b.macroLocation == MacroLocation::Macro) &&
+		!b.finalPosition.isValid();
+}
 
-	if (tile == BWAPI::TilePositions::None)
+// The site is still open. Power is not checked: Placement may choose a spot that a
+// pylon in progress will power, and ProductionManager allows for that.
+bool BuildingManager::prefetchedSiteIsValid(const PrefetchedSite & site) const
+{
+	for (int x = site.tile.x; x < site.tile.x + site.type.tileWidth(); ++x)
 	{
-		Log().Get() << "Failed to place " << b.type;
-		_dontPlaceUntil = BWAPI::Broodwar->getFrameCount() + 100;
+		for (int y = site.tile.y; y < site.tile.y + site.type.tileHeight(); ++y)
+		{
+			BWAPI::TilePosition tile(x, y);
+			if (!tile.isValid() ||
+				!BWAPI::Broodwar->isBuildable(tile, true) ||
+				(site.type.requiresCreep() && !BWAPI::Broodwar->hasCreep(tile)))
+			{
+				return false;
+			}
+		}
 	}
-	else
+	return true;
+}
+
+// The index of a valid prefetched site for the building, or -1 if none.
+int BuildingManager::findPrefetchedSite(const Building & b) const
+{
+	if (canPrefetch(b))
 	{
-		Log().Get() << "Failed to place " << b.type << " with BWEB";
-		_dontPlaceUntil = 0;
+		for (size_t i = 0; i < _prefetchedSites.size(); ++i)
+		{
+			const PrefetchedSite & site = _prefetchedSites[i];
+			if (site.type == b.type && site.macroLocation == b.macroLocation && prefetchedSiteIsValid(site))
+			{
+				return int(i);
+			}
+		}
 	}
+	return -1;
+}
 
-	return tile;
+// The building has reserved its own tiles. If they came from a prefetched site, the site is used up.
+void BuildingManager::claimPrefetchedSite(const Building & b)
+{
+	for (auto it = _prefetchedSites.begin(); it != _prefetchedSites.end(); ++it)
+	{
+		if (it->type == b.type && it->tile == b.finalPosition)
+		{
+			_prefetchedSites.erase(it);
+			return;
+		}
+	}
+}
+
+// Find locations for upcoming buildings before they are needed, so that placement is
+// not done on the same frame that a building is started.
+// Each site is reserved, so that other placement leaves it open. A site is dropped if its
+// building is no longer coming, if the map changed under it, or if it is getting old.
+// At most one new site is placed per frame, and only if there is time to spare.
+void BuildingManager::prefetchBuildingLocations(const std::vector<Building> & upcoming, int msAvailable)
+{
+	const int now = BWAPI::Broodwar->getFrameCount();
+
+	// Buildings added but not yet placed still want their sites.
+	std::vector<const Building *> wanted;
+	for (const Building & b : upcoming)
+	{
+		if (canPrefetch(b))
+		{
+			wanted.push_back(&b);
+		}
+	}
+	for (const Building & b : _buildings)
+	{
+		if (b.status == BuildingStatus::Unassigned && canPrefetch(b))
+		{
+			wanted.push_back(&b);
+		}
+	}
+
+	// 1. Match the sites we have to the buildings that want them. Drop the rest.
+	std::vector<bool> served(wanted.size(), false);
+	for (size_t i = 0; i < _prefetchedSites.size(); )
+	{
+		const PrefetchedSite & site = _prefetchedSites[i];
+
+		int match = -1;
+		for (size_t j = 0; j < wanted.size(); ++j)
+		{
+			if (!served[j] && wanted[j]->type == site.type && wanted[j]->macroLocation == site.macroLocation)
+			{
+				match = int(j);
+				break;
+			}
+		}
+
+		if (match < 0 || now - site.frame > PrefetchedSiteLifetime || !prefetchedSiteIsValid(site))
+		{
+			BuildingPlacer::Instance().freePrefetchedTiles(site.tile, site.type.tileWidth(), site.type.tileHeight());
+			_prefetchedSites.erase(_prefetchedSites.begin() + i);
+		}
+		else
+		{
+			served[match] = true;
+			++i;
+		}
+	}
+
+	// 2. Place the first building that has no site, if there is time.
+	if (msAvailable < MinMillisecondsToPrefetch || now < _prefetchRetryFrame)
+	{
+		return;
+	}
+
+	for (size_t j = 0; j < wanted.size(); ++j)
+	{
+		if (!served[j])
+		{
+			// A failed prefetch is not a failed placement: don't log it or hold up real placement.
+			const Building & b = *wanted[j];
+			bool usedFallback = false;
+			BWAPI::TilePosition tile = findBuildingLocation(b, usedFallback);
+			if (tile.isValid())
+			{
+				BuildingPlacer::Instance().reserveTiles(tile, b.type.tileWidth(), b.type.tileHeight());
+				_prefetchedSites.push_back(PrefetchedSite(b.type, b.macroLocation, tile, now));
+			}
+			else
+			{
+				_prefetchRetryFrame = now + 24;
+			}
+			return;
+		}
+	}
 }
 
 // The building failed or is canceled.
@@ -8,6 +8,23 @@
 
 namespace UAlbertaBot
 {
+// A location found and reserved ahead of time for a building that is still in the queue.
+struct PrefetchedSite
+{
+	BWAPI::UnitType		type;
+	MacroLocation		macroLocation;
+	BWAPI::TilePosition	tile;
+	int					frame;			// when it was found
+
+	PrefetchedSite(BWAPI::UnitType t, MacroLocation loc, BWAPI::TilePosition pos, int f)
+		: type(t)
+		, macroLocation(loc)
+		, tile(pos)
+		, frame(f)
+	{
+	}
+};
+
 class BuildingManager
 {
     BuildingManager();
@@ -20,6 +37,9 @@ class BuildingManager
 
 	bool			_stalledForLackOfSpace;			// no valid location to place a protoss building
 
+	std::vector<PrefetchedSite>	_prefetchedSites;	// reserved in BuildingPlacer until used or dropped
+	int				_prefetchRetryFrame;			// after a failed prefetch, wait until this frame
+
     bool            isBuildingPositionExplored(const Building & b) const;
 	void			undoBuildings(const std::vector<Building> & toRemove);
     void            removeBuildings(const std::vector<Building> & toRemove);
@@ -37,6 +57,13 @@ class BuildingManager
 
 	void			setBuilderUnit(Building & b);
 	void			releaseBuilderUnit(const Building & b);
+
+	BWAPI::TilePosition	computeBuildingLocation(const Building & b);
+	BWAPI::TilePosition	findBuildingLocation(const Building & b, bool & usedFallback) const;
+	bool			canPrefetch(const Building & b) const;
+	bool			prefetchedSiteIsValid(const PrefetchedSite & site) const;
+	int				findPrefetchedSite(const Building & b) const;
+	void			claimPrefetchedSite(const Building & b);
     
 public:
     
@@ -49,6 +76,7 @@ public:
 	void                addBuildingTask(const MacroAct & act, BWAPI::TilePosition desiredLocation, bool isWorkerScoutBuilding);
     void                drawBuildingInformation(int x,int y);
     BWAPI::TilePosition getBuildingLocation(const Building & b);
+	void				prefetchBuildingLocations(const std::vector<Building> & upcoming, int msAvailable);
 
     int                 getReservedMinerals() const;
     int                 getReservedGas() const;
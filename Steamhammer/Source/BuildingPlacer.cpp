@@ -3,6 +3,8 @@
 #include "MapGrid.h"
 #include "MapTools.h"
 
+#include "../../BOSS/source/Timer.hpp"
+
 using namespace UAlbertaBot;
 
 namespace { auto & bwebMap = BWEB::Map::Instance(); }
@@ -214,7 +216,7 @@ bool BuildingPlacer::tileOverlapsBaseLocation(BWAPI::TilePosition tile, BWAPI::U
     int ty2 = ty1 + type.tileHeight();
 
     // for each base location
-    for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+    for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
     {
         // dimensions of the base location
         int bx1 = base->getTilePosition().x;
@@ -331,6 +333,39 @@ void BuildingPlacer::freeTiles(BWAPI::TilePosition position, int width, int heig
     }
 }
 
+// Release tiles reserved for a prefetched site. BWEB marks the tiles of buildings in the same
+// used tile set, so keep any tile that a building now stands on.
+void BuildingPlacer::freePrefetchedTiles(BWAPI::TilePosition position, int width, int height)
+{
+	int rwidth = _reserveMap.size();
+	int rheight = _reserveMap[0].size();
+
+	for (int x = position.x; x < position.x + width && x < rwidth; x++)
+	{
+		for (int y = position.y; y < position.y + height && y < rheight; y++)
+		{
+			BWAPI::TilePosition t(x, y);
+			if (!t.isValid()) continue;
+
+			_reserveMap[x][y] = false;
+
+			bool occupied = false;
+			for (BWAPI::Unit unit : BWAPI::Broodwar->getUnitsOnTile(t))
+			{
+				if (unit->getType().isBuilding() && !unit->isFlying())
+				{
+					occupied = true;
+					break;
+				}
+			}
+			if (!occupied)
+			{
+				bwebMap.getUsedTiles().erase(t);
+			}
+		}
+	}
+}
+
 // NOTE This allows building only on accessible geysers.
 BWAPI::TilePosition BuildingPlacer::getRefineryPosition()
 {
@@ -387,7 +422,14 @@ void BuildingPlacer::initializeBWEB()
     // TODO: Check if non-tight walls are better vs. protoss and terran
     _wall = LocutusWall::CreateForgeGatewayWall(true);
 
+	BOSS::Timer timer;
+	timer.start();
     bwebMap.findBlocks();
+	double ms = timer.getElapsedTimeInMilliSec();
+
+	// An exhaustive search would check every candidate.
+	Log().Get() << "BWEB found " << bwebMap.blocks.size() << " blocks in " << ms << "ms, checking "
+		<< bwebMap.blockChecks << " of " << bwebMap.blockCandidates << " candidates";
 }
 
 BWAPI::TilePosition BuildingPlacer::placeBuildingBWEB(BWAPI::UnitType type, BWAPI::TilePosition closeTo)
@@ -480,8 +522,8 @@ BWAPI::TilePosition BuildingPlacer::placeBuildingBWEB(BWAPI::UnitType type, BWAP
 		if (poweredLarge == 0 && tileBestPowersLarge.isValid()) return tileBestPowersLarge;
 
 		// Invalidate the medium and large powering tiles if they are in a different area from the best tile
-		if (tileBestPowersMedium.isValid() && BWTA::getRegion(tileBest) != BWTA::getRegion(tileBestPowersMedium)) tileBestPowersMedium = BWAPI::TilePositions::Invalid;
-		if (tileBestPowersLarge.isValid() && BWTA::getRegion(tileBest) != BWTA::getRegion(tileBestPowersLarge)) tileBestPowersLarge = BWAPI::TilePositions::Invalid;
+		if (tileBestPowersMedium.isValid() && MapAnalysis::Instance().getRegion(tileBest) != MapAnalysis::Instance().getRegion(tileBestPowersMedium)) tileBestPowersMedium = BWAPI::TilePositions::Invalid;
+		if (tileBestPowersLarge.isValid() && MapAnalysis::Instance().getRegion(tileBest) != MapAnalysis::Instance().getRegion(tileBestPowersLarge)) tileBestPowersLarge = BWAPI::TilePositions::Invalid;
 
 		// Return the medium tile if it is valid and we have more use for it than the large tile
 		if (tileBestPowersMedium.isValid())
@@ -44,6 +44,7 @@ public:
 
 	void				reserveTiles(BWAPI::TilePosition position, int width, int height);
     void				freeTiles(BWAPI::TilePosition position,int width,int height);
+	void				freePrefetchedTiles(BWAPI::TilePosition position, int width, int height);
 
     void				drawReservedTiles();
     void				computeResourceBox();
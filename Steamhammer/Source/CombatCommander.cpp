@@ -94,6 +94,7 @@ void CombatCommander::update(const BWAPI::Unitset & combatUnits)
 		updateBaseDefenseSquads();
 		updateReconSquad();
 		updateAttackSquads();
+		staggerCombatSims();
 	}
 	else if (frame8 % 4 == 2)
 	{
@@ -107,6 +108,20 @@ void CombatCommander::update(const BWAPI::Unitset & combatUnits)
 	cancelDyingItems();
 }
 
+// Give the squads different phases for starting amortized combat sims,
+// so that a big fight doesn't start every squad's simulation on the same frame.
+void CombatCommander::staggerCombatSims()
+{
+	const int period = CombatSimulation::AmortizedFrames();
+
+	int phase = 0;
+	for (const auto & kv : _squadData.getSquads())
+	{
+		_squadData.getSquad(kv.first).setCombatSimPhase(phase);
+		phase = (phase + 1) % period;
+	}
+}
+
 void CombatCommander::updateIdleSquad()
 {
     Squad & idleSquad = _squadData.getSquad("Idle");
@@ -340,12 +355,12 @@ void CombatCommander::chooseReconTarget()
 // Called only by setReconTarget().
 BWAPI::Position CombatCommander::getReconLocation() const
 {
-	std::vector<BWTA::BaseLocation *> choices;
+	std::vector<BaseLocation *> choices;
 
 	BWAPI::Position mainPosition = InformationManager::Instance().getMyMainBaseLocation()->getPosition();
 
 	// The choices are neutral bases reachable by ground.
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (InformationManager::Instance().getBaseOwner(base) == BWAPI::Broodwar->neutral() &&
 			MapTools::Instance().getGroundTileDistance(base->getPosition(), mainPosition) != -1)
@@ -363,7 +378,7 @@ BWAPI::Position CombatCommander::getReconLocation() const
 	// Choose randomly.
 	// We may choose the same target we already have. That's OK; if there's another choice,
 	// we'll probably switch to it soon.
-	BWTA::BaseLocation * base = choices.at(Random::Instance().index(choices.size()));
+	BaseLocation * base = choices.at(Random::Instance().index(choices.size()));
 	return base->getPosition();
 }
 
@@ -469,10 +484,10 @@ void CombatCommander::updateAttackSquads()
 		int radius = DefensivePositionRadius;
 
 		// We are guaranteed to always have a main base location, even if it has been destroyed.
-		BWTA::BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
+		BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
 
 		// We may have taken our natural. If so, call that the front line.
-		BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+		BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
 		if (natural && BWAPI::Broodwar->self() == InformationManager::Instance().getBaseOwner(natural))
 		{
 			base = natural;
@@ -641,7 +656,7 @@ void CombatCommander::updateScoutDefenseSquad()
     Squad & scoutDefenseSquad = _squadData.getSquad("ScoutDefense");
   
     // get the region that our base is located in
-    BWTA::Region * myRegion = BWTA::getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition());
+    Region * myRegion = MapAnalysis::Instance().getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition());
     if (!myRegion || !myRegion->getCenter().isValid())
     {
         return;
@@ -651,7 +666,7 @@ void CombatCommander::updateScoutDefenseSquad()
     bool chaseScout = true;
     for (const auto unit : BWAPI::Broodwar->enemy()->getUnits())
     {
-        if (BWTA::getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion)
+        if (MapAnalysis::Instance().getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion)
         {
             // If an enemy worker has attacked recently, consider workers to not be scouts
             if (unit->getType() != BWAPI::UnitTypes::Zerg_Overlord &&
@@ -677,7 +692,7 @@ void CombatCommander::updateScoutDefenseSquad()
         for (const auto unit : _combatUnits)
         {
             if (unit->getType() == BWAPI::UnitTypes::Protoss_Dragoon &&
-                BWTA::getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion &&
+                MapAnalysis::Instance().getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion &&
                 _squadData.canAssignUnitToSquad(unit, scoutDefenseSquad))
             {
                 _squadData.assignUnitToSquad(unit, scoutDefenseSquad);
@@ -694,23 +709,23 @@ void CombatCommander::updateBaseDefenseSquads()
         return; 
     }
     
-    BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
-    BWTA::Region * enemyRegion = nullptr;
+    BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+    Region * enemyRegion = nullptr;
     if (enemyBaseLocation)
     {
-        enemyRegion = BWTA::getRegion(enemyBaseLocation->getPosition());
+        enemyRegion = MapAnalysis::Instance().getRegion(enemyBaseLocation->getPosition());
     }
 
-	BWTA::BaseLocation * mainBaseLocation = InformationManager::Instance().getMyMainBaseLocation();
-	BWTA::Region * mainRegion = nullptr;
+	BaseLocation * mainBaseLocation = InformationManager::Instance().getMyMainBaseLocation();
+	Region * mainRegion = nullptr;
 	if (mainBaseLocation)
 	{
-		mainRegion = BWTA::getRegion(mainBaseLocation->getPosition());
+		mainRegion = MapAnalysis::Instance().getRegion(mainBaseLocation->getPosition());
 	}
 
 	// for each of our occupied regions
     auto & occupiedRegions = InformationManager::Instance().getOccupiedRegions(BWAPI::Broodwar->self());
-	for (BWTA::Region * myRegion : BWTA::getRegions())
+	for (Region * myRegion : MapAnalysis::Instance().getRegions())
 	{
         // don't defend inside the enemy region, this will end badly when we are stealing gas
         if (myRegion == enemyRegion)
@@ -754,7 +769,7 @@ void CombatCommander::updateBaseDefenseSquads()
                 continue;
             }
 
-            if (BWTA::getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion)
+            if (MapAnalysis::Instance().getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion)
             {
                 enemyUnitsInRegion.insert(unit);
             }
@@ -860,7 +875,7 @@ void CombatCommander::updateBaseDefenseSquads()
 				unit->getType() == BWAPI::UnitTypes::Protoss_Photon_Cannon ||
 				unit->getType() == BWAPI::UnitTypes::Zerg_Spore_Colony) &&
 				unit->isCompleted() && unit->isPowered() &&
-				(BWTA::getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion ||
+				(MapAnalysis::Instance().getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion ||
 				defenseSquad.getSquadOrder().getPosition().getDistance(unit->getPosition()) < 500))
 			{
 				flyingDefendersNeeded -= 3;
@@ -876,7 +891,7 @@ void CombatCommander::updateBaseDefenseSquads()
 			if ((unit->getType() == BWAPI::UnitTypes::Protoss_Photon_Cannon ||
 				unit->getType() == BWAPI::UnitTypes::Zerg_Sunken_Colony) &&
 				unit->isCompleted() && unit->isPowered() &&
-				(BWTA::getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion ||
+				(MapAnalysis::Instance().getRegion(BWAPI::TilePosition(unit->getPosition())) == myRegion ||
 				defenseSquad.getSquadOrder().getPosition().getDistance(unit->getPosition()) < 500))
 			{
 				sunkenDefender = true;
@@ -1177,7 +1192,7 @@ void CombatCommander::cancelDyingItems()
 
 BWAPI::Position CombatCommander::getDefendLocation()
 {
-	return BWTA::getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition())->getCenter();
+	return MapAnalysis::Instance().getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition())->getCenter();
 }
 
 // How good is it to pull this worker for combat?
@@ -1269,9 +1284,9 @@ Handled earlier in Locutus
 	// Only if the squad can attack ground. Lift the command center and it is no longer counted as a base.
 	if (canAttackGround)
 	{
-		BWTA::BaseLocation * targetBase = nullptr;
+		BaseLocation * targetBase = nullptr;
 		int bestScore = -99999;
-		for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+		for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 		{
 			if (InformationManager::Instance().getBaseOwner(base) == BWAPI::Broodwar->enemy())
 			{
@@ -1426,10 +1441,10 @@ BWAPI::Position CombatCommander::getDropLocation(const Squad & squad)
 BWAPI::Position CombatCommander::getDefenseLocation()
 {
 	// We are guaranteed to always have a main base location, even if it has been destroyed.
-	BWTA::BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
+	BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
 
 	// We may have taken our natural. If so, call that the front line.
-	BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+	BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
 	if (natural && BWAPI::Broodwar->self() == InformationManager::Instance().getBaseOwner(natural))
 	{
 		base = natural;
@@ -1478,7 +1493,7 @@ int CombatCommander::numZerglingsInOurBase() const
     const int concernRadius = 300;
     int zerglings = 0;
 	
-	BWTA::BaseLocation * main = InformationManager::Instance().getMyMainBaseLocation();
+	BaseLocation * main = InformationManager::Instance().getMyMainBaseLocation();
 	BWAPI::Position myBasePosition(main->getPosition());
 
     for (auto unit : BWAPI::Broodwar->enemy()->getUnits())
@@ -1502,7 +1517,7 @@ bool CombatCommander::buildingRush() const
 		return false;
 	}
 
-	BWTA::BaseLocation * main = InformationManager::Instance().getMyMainBaseLocation();
+	BaseLocation * main = InformationManager::Instance().getMyMainBaseLocation();
 	BWAPI::Position myBasePosition(main->getPosition());
 
     for (const auto unit : BWAPI::Broodwar->enemy()->getUnits())
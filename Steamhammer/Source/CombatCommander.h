@@ -28,6 +28,7 @@ class CombatCommander
 	void            updateAttackSquads();
     void            updateDropSquads();
 	void            updateIdleSquad();
+	void			staggerCombatSims();
 
 	void			loadOrUnloadBunkers();
 	void			doComsatScan();
@@ -1,10 +1,17 @@
 #include "CombatSimulation.h"
-#include "FAP.h"
 #include "UnitUtil.h"
 
 using namespace UAlbertaBot;
 
+namespace
+{
+	// Check the scores at these numbers of simulated frames. The last is SimulationFrames.
+	const std::vector<int> Horizons = { 24, 48, CombatSimulation::SimulationFrames };
+}
+
 CombatSimulation::CombatSimulation()
+	: _framesLeft(0)
+	, _confidence(0.0)
 {
 }
 
@@ -12,7 +19,10 @@ CombatSimulation::CombatSimulation()
 // this center will most likely be the position of the forwardmost combat unit we control
 void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius, bool visibleOnly)
 {
-	fap.clearState();
+	_fap.clearState();
+	_framesLeft = SimulationFrames;
+	_confidence = 0.0;
+	_trajectory.clear();
 
 	if (Config::Debug::DrawCombatSimulationInfo)
 	{
@@ -37,7 +47,7 @@ void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius
 		{
 			if (unit->getHitPoints() > 0 && UnitUtil::IsCombatSimUnit(unit))
 			{
-				fap.addIfCombatUnitPlayer2(unit);
+				_fap.addIfCombatUnitPlayer2(unit);
 				if (Config::Debug::DrawCombatSimulationInfo)
 				{
 					BWAPI::Broodwar->drawCircleMap(unit->getPosition(), 3, BWAPI::Colors::Orange, true);
@@ -56,7 +66,7 @@ void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius
 				!ui.unit->isVisible() &&
 				UnitUtil::IsCombatSimUnit(ui.type))
 			{
-				fap.addIfCombatUnitPlayer2(ui);
+				_fap.addIfCombatUnitPlayer2(ui);
 				if (Config::Debug::DrawCombatSimulationInfo)
 				{
 					BWAPI::Broodwar->drawCircleMap(ui.lastPosition, 3, BWAPI::Colors::Orange, true);
@@ -77,7 +87,7 @@ void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius
 				(ui.unit->exists() || ui.lastPosition.isValid() && !ui.goneFromLastPosition) &&
 				(ui.unit->exists() ? UnitUtil::IsCombatSimUnit(ui.unit) : UnitUtil::IsCombatSimUnit(ui.type)))
 			{
-				fap.addIfCombatUnitPlayer2(ui);
+				_fap.addIfCombatUnitPlayer2(ui);
 				if (ui.type == BWAPI::UnitTypes::Zerg_Spore_Colony)
 				{
 					compensatoryMutalisks += 5;
@@ -102,7 +112,7 @@ void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius
 				--compensatoryMutalisks;
 				continue;
 			}
-			fap.addIfCombatUnitPlayer1(unit);
+			_fap.addIfCombatUnitPlayer1(unit);
 			if (Config::Debug::DrawCombatSimulationInfo)
 			{
 				BWAPI::Broodwar->drawCircleMap(unit->getPosition(), 3, BWAPI::Colors::Green, true);
@@ -113,16 +123,78 @@ void CombatSimulation::setCombatUnits(const BWAPI::Position & center, int radius
 
 double CombatSimulation::simulateCombat()
 {
-	fap.simulate();
-	std::pair<int, int> scores = fap.playerScores();
+	if (_framesLeft == SimulationFrames)
+	{
+		_confidence = _fap.simulateHorizons(Horizons, Config::Micro::CombatSimDecisiveMargin, _trajectory);
+		_framesLeft = 0;
+	}
+	else
+	{
+		advance(_framesLeft);
+	}
+	return getScore();
+}
+
+int CombatSimulation::AmortizedFrames()
+{
+	const int framesPerTick = Config::Micro::CombatSimFramesPerTick;
+	return framesPerTick > 0 ? (SimulationFrames + framesPerTick - 1) / framesPerTick : 1;
+}
+
+void CombatSimulation::checkpoint(int frame)
+{
+	FastAPproximation::Checkpoint cp;
+	cp.frame = frame;
+	cp.scores = _fap.playerScores();
+	_trajectory.push_back(cp);
+	_confidence = _fap.confidence();
+}
+
+// Simulate up to nFrames more frames, stopping at each horizon to check the scores.
+// Return true when the simulation is done.
+bool CombatSimulation::advance(int nFrames)
+{
+	while (nFrames > 0 && _framesLeft > 0)
+	{
+		const int done = SimulationFrames - _framesLeft;
+		const int horizon = *std::upper_bound(Horizons.begin(), Horizons.end(), done);
+		const int wanted = std::min(nFrames, horizon - done);
+		const int ran = _fap.simulate(wanted);
+
+		_framesLeft -= ran;
+		nFrames -= wanted;
+
+		if (ran < wanted)
+		{
+			// The fight ended early.
+			checkpoint(done + ran);
+			_framesLeft = 0;
+		}
+		else if (done + ran == horizon)
+		{
+			checkpoint(horizon);
+			if (_confidence >= Config::Micro::CombatSimDecisiveMargin)
+			{
+				_framesLeft = 0;
+			}
+		}
+	}
+
+	return _framesLeft == 0;
+}
+
+// The score of the simulation so far. Positive if we come out ahead.
+double CombatSimulation::getScore() const
+{
+	std::pair<int, int> scores = _fap.playerScores();
 
 	int score = scores.first - scores.second;
 
 	if (Config::Debug::DrawCombatSimulationInfo)
 	{
-		BWAPI::Broodwar->drawTextScreen(150, 200, "%cCombat sim: us %c%d %c- them %c%d %c= %c%d",
+		BWAPI::Broodwar->drawTextScreen(150, 200, "%cCombat sim: us %c%d %c- them %c%d %c= %c%d %cconfidence %.2f",
 			white, orange, scores.first, white, orange, scores.second, white,
-			score >= 0 ? green : red, score);
+			score >= 0 ? green : red, score, white, _confidence);
 	}
 
 	return double(score);
@@ -1,20 +1,46 @@
 #pragma once
 
 #include "Common.h"
+#include "FAP.h"
 #include "MapGrid.h"
 
 #include "InformationManager.h"
 
 namespace UAlbertaBot
 {
+// setCombatUnits() starts a simulation. Either run it all at once with simulateCombat(),
+// or spread it over several game frames by calling advance() once per frame until it
+// returns true, then read getScore().
+// Either way, the scores are checkpointed at each of several horizons, and the simulation
+// stops at the first checkpoint where the outcome is decisive, by Config::Micro::CombatSimDecisiveMargin.
 class CombatSimulation
 {
+	FastAPproximation	_fap;
+	int					_framesLeft;		// simulated frames still to go; 0 if no simulation is running
+	double				_confidence;		// at the latest checkpoint, 0 = even fight, 1 = one-sided
+	std::vector<FastAPproximation::Checkpoint> _trajectory;
+
+	void	checkpoint(int frame);
+
 public:
 
+	static const int SimulationFrames = 96;	// 4 seconds on fastest; the last horizon
+
+	// Game frames that an amortized simulation takes, with Config::Micro::CombatSimFramesPerTick.
+	static int AmortizedFrames();
+
 	CombatSimulation();
 
 	void setCombatUnits(const BWAPI::Position & center, const int radius, bool visibleOnly);
 
 	double simulateCombat();
+
+	bool isRunning() const { return _framesLeft > 0; };
+	bool advance(int nFrames);
+	void stop() { _framesLeft = 0; };
+	double getScore() const;
+
+	double getConfidence() const { return _confidence; };
+	const std::vector<FastAPproximation::Checkpoint> & getTrajectory() const { return _trajectory; };
 };
 }
\ No newline at end of file
@@ -103,6 +103,8 @@ namespace Config
 		int RetreatMeleeUnitShields         = 0;
         int RetreatMeleeUnitHP              = 0;
 		int CombatSimRadius					= 300;      // radius of units around frontmost unit for combat sim
+		int CombatSimFramesPerTick			= 24;		// simulated frames per game frame for each squad, 0 = all at once
+		double CombatSimDecisiveMargin		= 0.5;		// stop the combat sim early if (us - them) / (us + them) is this lopsided
         int UnitNearEnemyRadius             = 600;      // radius to consider a unit 'near' to an enemy unit
 		int ScoutDefenseRadius				= 600;		// radius to chase enemy scout worker
     }
@@ -110,6 +112,7 @@ namespace Config
     namespace Macro
     {
         int BOSSFrameLimit                  = 160;
+        int FrameBudgetMs                   = 35;       // time per frame that search and prefetching may fill
         int WorkersPerRefinery              = 3;
 		double WorkersPerPatch              = 3.0;
 		int AbsoluteMaxWorkers				= 75;
@@ -117,6 +120,7 @@ namespace Config
         int PylonSpacing                    = 3;
 		int ProductionJamFrameLimit			= 360;
 		bool ExpandToIslands				= false;
+		bool MineByMarginalIncome			= true;		// false: the old fewest-workers patch assignment
     }
 
     namespace Tools								
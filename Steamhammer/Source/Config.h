@@ -97,6 +97,8 @@ namespace Config
         extern int RetreatMeleeUnitShields;
         extern int RetreatMeleeUnitHP;
         extern int CombatSimRadius;         
+		extern int CombatSimFramesPerTick;
+		extern double CombatSimDecisiveMargin;
         extern int UnitNearEnemyRadius;         
 		extern int ScoutDefenseRadius;
 	}
@@ -104,6 +106,7 @@ namespace Config
     namespace Macro
     {
         extern int BOSSFrameLimit;
+        extern int FrameBudgetMs;
         extern int WorkersPerRefinery;
 		extern double WorkersPerPatch;
 		extern int AbsoluteMaxWorkers;
@@ -111,6 +114,7 @@ namespace Config
         extern int PylonSpacing;
 		extern int ProductionJamFrameLimit;
 		extern bool ExpandToIslands;
+		extern bool MineByMarginalIncome;
     }
 
     namespace Tools
@@ -1,8 +1,6 @@
 #include "FAP.h"
 #include "BWAPI.h"
 
-UAlbertaBot::FastAPproximation fap;
-
 // NOTE FAP does not use UnitInfo.goneFromLastPosition. The flag is always set false
 // on a UnitInfo value which is passed in (CombatSimulation makes sure of it).
 
@@ -28,18 +26,45 @@ namespace UAlbertaBot {
             addUnitPlayer2(fu);
     }
 
-    void FastAPproximation::simulate(int nFrames) {
-        while (nFrames--) {
+    int FastAPproximation::simulate(int nFrames) {
+        int frames = 0;
+        while (frames < nFrames) {
             if (!player1.size() || !player2.size())
                 break;
 
             didSomething = false;
 
             isimulate();
+            ++frames;
 
             if (!didSomething)
                 break;
         }
+        return frames;
+    }
+
+    double FastAPproximation::simulateHorizons(const std::vector<int> &horizons,
+        double decisiveMargin, std::vector<Checkpoint> &trajectory) {
+        trajectory.clear();
+        int frames = 0;
+        for (int horizon : horizons) {
+            const int wanted = horizon - frames;
+            const int ran = simulate(wanted);
+            frames += ran;
+            trajectory.push_back(Checkpoint{ frames, playerScores() });
+
+            if (ran < wanted || confidence() >= decisiveMargin)
+                break;
+        }
+        return confidence();
+    }
+
+    double FastAPproximation::confidence() const {
+        const std::pair<int, int> scores = playerScores();
+        const int total = scores.first + scores.second;
+        if (total <= 0)
+            return 1.0;
+        return std::abs(scores.first - scores.second) / double(total);
     }
 
     const auto score = [](const FastAPproximation::FAPUnit &fu) {
@@ -58,7 +58,23 @@ namespace UAlbertaBot {
         void addUnitPlayer2(FAPUnit fu);
         void addIfCombatUnitPlayer2(FAPUnit fu);
 
-        void simulate(int nFrames = 96); // = 24*4, 4 seconds on fastest
+        // Returns the number of frames simulated, fewer than nFrames if the fight ended.
+        int simulate(int nFrames = 96); // = 24*4, 4 seconds on fastest
+
+        // The scores after a given number of simulated frames.
+        struct Checkpoint {
+            int frame;
+            std::pair<int, int> scores;
+        };
+
+        // Simulate to each of the increasing horizons in turn, recording a checkpoint at each.
+        // Stop at the first checkpoint whose confidence() is at least decisiveMargin,
+        // or when the fight ends. Returns the confidence at the last checkpoint.
+        double simulateHorizons(const std::vector<int> &horizons, double decisiveMargin,
+            std::vector<Checkpoint> &trajectory);
+
+        // How one-sided the current scores are: 0 if even, 1 if one side has nothing left.
+        double confidence() const;
 
         std::pair<int, int> playerScores() const;
         std::pair<int, int> playerScoresUnits() const;
@@ -84,5 +100,3 @@ namespace UAlbertaBot {
         };
 
 }
-
-extern UAlbertaBot::FastAPproximation fap;
\ No newline at end of file
@@ -67,7 +67,7 @@ void GameCommander::update()
 #endif
 
 	_timerManager.startTimer(TimerManager::Search);
-	BOSSManager::Instance().update(35 - _timerManager.getMilliseconds());
+	BOSSManager::Instance().update(Config::Macro::FrameBudgetMs - _timerManager.getMilliseconds());
 	_timerManager.stopTimer(TimerManager::Search);
 
 #ifdef CRASH_DEBUG
@@ -92,6 +92,7 @@ void GameCommander::update()
 
 	_timerManager.startTimer(TimerManager::Building);
 	BuildingManager::Instance().update();
+	ProductionManager::Instance().prefetchBuildingLocations(Config::Macro::FrameBudgetMs - _timerManager.getMilliseconds());
 	_timerManager.stopTimer(TimerManager::Building);
 
 #ifdef CRASH_DEBUG
@@ -402,21 +403,29 @@ void GameCommander::onUnitHide(BWAPI::Unit unit)
 
 void GameCommander::onUnitCreate(BWAPI::Unit unit)		
 { 
+	UnitUtil::InvalidateUnitCounts();
+	ProductionManager::Instance().wakeUp();
 	InformationManager::Instance().onUnitCreate(unit); 
 }
 
 void GameCommander::onUnitComplete(BWAPI::Unit unit)
 {
+	UnitUtil::InvalidateUnitCounts();
+	ProductionManager::Instance().wakeUp();
 	InformationManager::Instance().onUnitComplete(unit);
 }
 
 void GameCommander::onUnitRenegade(BWAPI::Unit unit)		
 { 
+	UnitUtil::InvalidateUnitCounts();
+	ProductionManager::Instance().wakeUp();
 	InformationManager::Instance().onUnitRenegade(unit); 
 }
 
 void GameCommander::onUnitDestroy(BWAPI::Unit unit)		
 { 	
+	UnitUtil::InvalidateUnitCounts();
+	ProductionManager::Instance().wakeUp();
 	ProductionManager::Instance().onUnitDestroy(unit);
 	WorkerManager::Instance().onUnitDestroy(unit);
 	InformationManager::Instance().onUnitDestroy(unit); 
@@ -424,6 +433,8 @@ void GameCommander::onUnitDestroy(BWAPI::Unit unit)
 
 void GameCommander::onUnitMorph(BWAPI::Unit unit)		
 { 
+	UnitUtil::InvalidateUnitCounts();
+	ProductionManager::Instance().wakeUp();
 	InformationManager::Instance().onUnitMorph(unit);
 	WorkerManager::Instance().onUnitMorph(unit);
 }
@@ -431,7 +442,7 @@ void GameCommander::onUnitMorph(BWAPI::Unit unit)
 BWAPI::Unit GameCommander::getScoutWorker()
 {
 	// We get the free worker closest to the natural
-	BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+	BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
 	BWAPI::Unit bestUnit = nullptr;
 	double best = DBL_MAX;
 
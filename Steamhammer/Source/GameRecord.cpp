@@ -293,7 +293,7 @@ int GameRecord::snapDistance(const PlayerSnapshot & a, const PlayerSnapshot & b)
 // Figure out whether the enemy has seen our base yet.
 bool GameRecord::enemyScoutedUs() const
 {
-	BWTA::BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
+	BaseLocation * base = InformationManager::Instance().getMyMainBaseLocation();
 
 	for (const auto & kv : InformationManager::Instance().getUnitData(BWAPI::Broodwar->enemy()).getUnits())
 	{
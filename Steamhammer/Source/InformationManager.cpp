@@ -32,16 +32,23 @@ InformationManager::InformationManager()
 	initializeRegionInformation();
 	initializeNaturalBase();
 
-    // Normalize the enemy name by converting it to lowercase and removing spaces
-    _enemyName = BWAPI::Broodwar->enemy()->getName();
-    std::transform(_enemyName.begin(), _enemyName.end(), _enemyName.begin(), ::tolower);
-    _enemyName.erase(std::remove_if(_enemyName.begin(), _enemyName.end(), ::isspace), _enemyName.end());
+    _enemyName = NormalizedEnemyName();
+}
+
+// Normalize the enemy name by converting it to lowercase and removing spaces.
+// Static so that startup code can find the opponent model file before the map is analyzed.
+std::string InformationManager::NormalizedEnemyName()
+{
+    std::string name = BWAPI::Broodwar->enemy()->getName();
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+    name.erase(std::remove_if(name.begin(), name.end(), ::isspace), name.end());
+    return name;
 }
 
 // This fills in _theBases with neutral bases. An event will place our resourceDepot.
 void InformationManager::initializeTheBases()
 {
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		Base * knownBase = Bases::Instance().getBaseAtTilePosition(base->getTilePosition());
 		if (knownBase)
@@ -58,11 +65,11 @@ void InformationManager::initializeTheBases()
 // Set up _mainBaseLocations and _occupiedLocations.
 void InformationManager::initializeRegionInformation()
 {
-	_mainBaseLocations[_self] = BWTA::getStartLocation(_self);
-	_mainBaseLocations[_enemy] = BWTA::getStartLocation(_enemy);
+	_mainBaseLocations[_self] = MapAnalysis::Instance().getStartLocation(_self);
+	_mainBaseLocations[_enemy] = MapAnalysis::Instance().getStartLocation(_enemy);
 
 	// push that region into our occupied vector
-	updateOccupiedRegions(BWTA::getRegion(_mainBaseLocations[_self]->getTilePosition()), _self);
+	updateOccupiedRegions(MapAnalysis::Instance().getRegion(_mainBaseLocations[_self]->getTilePosition()), _self);
 }
 
 // Figure out what base is our "natural expansion". In rare cases, there might be none.
@@ -70,13 +77,13 @@ void InformationManager::initializeRegionInformation()
 void InformationManager::initializeNaturalBase()
 {
 	// We'll go through the bases and pick the best one as the natural.
-	BWTA::BaseLocation * bestBase = nullptr;
+	BaseLocation * bestBase = nullptr;
 	double bestScore = 0.0;
 
 	BWAPI::TilePosition homeTile = _self->getStartLocation();
 	BWAPI::Position myBasePosition(homeTile);
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		double score = 0.0;
 
@@ -92,7 +99,7 @@ void InformationManager::initializeNaturalBase()
 		double distanceFromUs = MapTools::Instance().getGroundTileDistance(BWAPI::Position(tile), myBasePosition);
 
 		// If it is not connected, skip it. Islands do this.
-		if (!BWTA::isConnected(homeTile, tile) || distanceFromUs < 0)
+		if (!MapAnalysis::Instance().isConnected(homeTile, tile) || distanceFromUs < 0)
 		{
 			continue;
 		}
@@ -117,7 +124,7 @@ void InformationManager::initializeNaturalBase()
 // A base is inferred to exist at the given position, without having been seen.
 // Only enemy bases can be inferred; we see our own.
 // Adjust its value to match. It is not reserved.
-void InformationManager::baseInferred(BWTA::BaseLocation * base)
+void InformationManager::baseInferred(BaseLocation * base)
 {
 	if (_theBases[base]->owner != _self)
 	{
@@ -132,7 +139,7 @@ void InformationManager::baseFound(BWAPI::Unit depot)
 {
 	UAB_ASSERT(depot && depot->getType().isResourceDepot(), "bad args");
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (closeEnough(base->getTilePosition(), depot->getTilePosition()))
 		{
@@ -144,7 +151,7 @@ void InformationManager::baseFound(BWAPI::Unit depot)
 
 // Set a base where the base and depot are both known.
 // The depot must be at or near the base location; this is not checked.
-void InformationManager::baseFound(BWTA::BaseLocation * base, BWAPI::Unit depot)
+void InformationManager::baseFound(BaseLocation * base, BWAPI::Unit depot)
 {
 	UAB_ASSERT(base && depot && depot->getType().isResourceDepot(), "bad args");
 
@@ -156,7 +163,7 @@ void InformationManager::baseFound(BWTA::BaseLocation * base, BWAPI::Unit depot)
 // If the lost base was our main, choose a new one if possible.
 void InformationManager::baseLost(BWAPI::TilePosition basePosition)
 {
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (closeEnough(base->getTilePosition(), basePosition))
 		{
@@ -168,7 +175,7 @@ void InformationManager::baseLost(BWAPI::TilePosition basePosition)
 
 // A base was lost and is now unowned.
 // If the lost base was our main, choose a new one if possible.
-void InformationManager::baseLost(BWTA::BaseLocation * base)
+void InformationManager::baseLost(BaseLocation * base)
 {
 	UAB_ASSERT(base, "bad args");
 
@@ -183,14 +190,14 @@ void InformationManager::baseLost(BWTA::BaseLocation * base)
 // Otherwise we'll keep trying to build in the old one, where the enemy may still be.
 void InformationManager::chooseNewMainBase()
 {
-	BWTA::BaseLocation * oldMain = getMyMainBaseLocation();
+	BaseLocation * oldMain = getMyMainBaseLocation();
 
 	// Choose a base we own which is as far away from the old main as possible.
 	// Maybe that will be safer.
 	double newMainDist = 0.0;
-	BWTA::BaseLocation * newMain = nullptr;
+	BaseLocation * newMain = nullptr;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (_theBases[base]->owner == _self)
 		{
@@ -218,8 +225,8 @@ void InformationManager::maybeChooseNewMainBase()
 	if (ProductionManager::Instance().isOutOfBook() && Random::Instance().index(2) == 0)
 	{
 		// 2. List my bases.
-		std::vector<BWTA::BaseLocation *> myBases;
-		for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+		std::vector<BaseLocation *> myBases;
+		for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 		{
 			if (_theBases[base]->owner == _self &&
 				_theBases[base]->resourceDepot &&
@@ -239,7 +246,7 @@ void InformationManager::maybeChooseNewMainBase()
 
 // The given unit was just created or morphed.
 // If it is a resource depot for our new base, record it.
-// NOTE: It is a base only if it's in the right position according to BWTA.
+// NOTE: It is a base only if it's in the right position according to the map analysis.
 // A resource depot will not be recorded if it is offset by too much.
 // NOTE: This records the initial depot at the start of the game.
 // There's no need to take special action to record the starting base.
@@ -323,13 +330,13 @@ void InformationManager::updateBaseLocationInfo()
 		bool baseFound = false;
 
 		// an unexplored base location holder
-		BWTA::BaseLocation * unexplored = nullptr;
+		BaseLocation * unexplored = nullptr;
 
-		for (BWTA::BaseLocation * startLocation : BWTA::getStartLocations()) 
+		for (BaseLocation * startLocation : MapAnalysis::Instance().getStartLocations()) 
 		{
-			if (isEnemyBuildingInRegion(BWTA::getRegion(startLocation->getTilePosition()))) 
+			if (isEnemyBuildingInRegion(MapAnalysis::Instance().getRegion(startLocation->getTilePosition()))) 
 			{
-				updateOccupiedRegions(BWTA::getRegion(startLocation->getTilePosition()), _enemy);
+				updateOccupiedRegions(MapAnalysis::Instance().getRegion(startLocation->getTilePosition()), _enemy);
 
 				// On a competition map, our base and the enemy base will never be in the same region.
 				// If we find an enemy building in our region, it's a proxy.
@@ -365,7 +372,7 @@ void InformationManager::updateBaseLocationInfo()
 		}
 
 		// if we've explored every start location except one, it's the enemy
-		if (!baseFound && exploredStartLocations + 1 == BWTA::getStartLocations().size())
+		if (!baseFound && exploredStartLocations + 1 == MapAnalysis::Instance().getStartLocations().size())
 		{
             if (Config::Debug::DrawScoutInfo)
             {
@@ -374,13 +381,13 @@ void InformationManager::updateBaseLocationInfo()
 			
 			_mainBaseLocations[_enemy] = unexplored;
 			baseInferred(unexplored);
-			updateOccupiedRegions(BWTA::getRegion(unexplored->getTilePosition()), _enemy);
+			updateOccupiedRegions(MapAnalysis::Instance().getRegion(unexplored->getTilePosition()), _enemy);
 		}
 	// otherwise we do know it, so push it back
 	}
 	else 
 	{
-		updateOccupiedRegions(BWTA::getRegion(_mainBaseLocations[_enemy]->getTilePosition()), _enemy);
+		updateOccupiedRegions(MapAnalysis::Instance().getRegion(_mainBaseLocations[_enemy]->getTilePosition()), _enemy);
 	}
 
 	// The enemy occupies a region if it has a building there.
@@ -390,7 +397,7 @@ void InformationManager::updateBaseLocationInfo()
 
 		if (ui.type.isBuilding() && !ui.goneFromLastPosition)
 		{
-			updateOccupiedRegions(BWTA::getRegion(BWAPI::TilePosition(ui.lastPosition)), _enemy);
+			updateOccupiedRegions(MapAnalysis::Instance().getRegion(BWAPI::TilePosition(ui.lastPosition)), _enemy);
 		}
 	}
 
@@ -401,7 +408,7 @@ void InformationManager::updateBaseLocationInfo()
 
 		if (ui.type.isBuilding() && !ui.goneFromLastPosition)
 		{
-			updateOccupiedRegions(BWTA::getRegion(BWAPI::TilePosition(ui.lastPosition)), _self);
+			updateOccupiedRegions(MapAnalysis::Instance().getRegion(BWAPI::TilePosition(ui.lastPosition)), _self);
 		}
 	}
 }
@@ -434,9 +441,9 @@ void InformationManager::enemyBaseLocationFromOverlordSighting()
 		}
 
 		// What bases could the overlord be from? Can we narrow it down to 1 possibility?
-		BWTA::BaseLocation * possibleEnemyBase = nullptr;
+		BaseLocation * possibleEnemyBase = nullptr;
 		int countPossibleBases = 0;
-		for (BWTA::BaseLocation * base : BWTA::getStartLocations())
+		for (BaseLocation * base : MapAnalysis::Instance().getStartLocations())
 		{
 			if (BWAPI::Broodwar->isExplored(base->getTilePosition()))
 			{
@@ -464,7 +471,7 @@ void InformationManager::enemyBaseLocationFromOverlordSighting()
 			// Success.
 			_mainBaseLocations[_enemy] = possibleEnemyBase;
 			baseInferred(possibleEnemyBase);
-			updateOccupiedRegions(BWTA::getRegion(possibleEnemyBase->getTilePosition()), _enemy);
+			updateOccupiedRegions(MapAnalysis::Instance().getRegion(possibleEnemyBase->getTilePosition()), _enemy);
 			return;
 		}
 	}
@@ -474,7 +481,7 @@ void InformationManager::enemyBaseLocationFromOverlordSighting()
 // Look for conflicting information and make corrections.
 void InformationManager::updateTheBases()
 {
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		// If we can see the tile where the resource depot would be.
 		if (BWAPI::Broodwar->isVisible(base->getTilePosition()))
@@ -511,7 +518,7 @@ void InformationManager::updateTheBases()
 	}
 }
 
-void InformationManager::updateOccupiedRegions(BWTA::Region * region, BWAPI::Player player) 
+void InformationManager::updateOccupiedRegions(Region * region, BWAPI::Player player) 
 {
 	// if the region is valid (flying buildings may be in nullptr regions)
 	if (region)
@@ -536,7 +543,7 @@ void InformationManager::updateGoneFromLastPosition()
 	}
 }
 
-bool InformationManager::isEnemyBuildingInRegion(BWTA::Region * region) 
+bool InformationManager::isEnemyBuildingInRegion(Region * region) 
 {
 	// invalid regions aren't considered the same, but they will both be null
 	if (!region)
@@ -549,7 +556,7 @@ bool InformationManager::isEnemyBuildingInRegion(BWTA::Region * region)
 		const UnitInfo & ui(kv.second);
 		if (ui.type.isBuilding() && !ui.goneFromLastPosition)
 		{
-			if (BWTA::getRegion(BWAPI::TilePosition(ui.lastPosition)) == region) 
+			if (MapAnalysis::Instance().getRegion(BWAPI::TilePosition(ui.lastPosition)) == region) 
 			{
 				return true;
 			}
@@ -564,25 +571,25 @@ const UIMap & InformationManager::getUnitInfo(BWAPI::Player player) const
 	return getUnitData(player).getUnits();
 }
 
-std::set<BWTA::Region *> & InformationManager::getOccupiedRegions(BWAPI::Player player)
+std::set<Region *> & InformationManager::getOccupiedRegions(BWAPI::Player player)
 {
 	return _occupiedRegions[player];
 }
 
-BWTA::BaseLocation * InformationManager::getMainBaseLocation(BWAPI::Player player)
+BaseLocation * InformationManager::getMainBaseLocation(BWAPI::Player player)
 {
 	return _mainBaseLocations[player];
 }
 
 // Guaranteed non-null. If we have no bases left, it is our start location.
-BWTA::BaseLocation * InformationManager::getMyMainBaseLocation()
+BaseLocation * InformationManager::getMyMainBaseLocation()
 {
 	UAB_ASSERT(_mainBaseLocations[_self], "no base location");
 	return _mainBaseLocations[_self];
 }
 
 // Null until the enemy base is located.
-BWTA::BaseLocation * InformationManager::getEnemyMainBaseLocation()
+BaseLocation * InformationManager::getEnemyMainBaseLocation()
 {
 	return _mainBaseLocations[_enemy];
 }
@@ -592,7 +599,7 @@ const BWEB::Station * InformationManager::getEnemyMainBaseStation()
 {
 	if (_enemyBaseStation) return _enemyBaseStation;
 
-	BWTA::BaseLocation * enemyBaseLocation = getEnemyMainBaseLocation();
+	BaseLocation * enemyBaseLocation = getEnemyMainBaseLocation();
 	if (!enemyBaseLocation) return nullptr;
 
 	double best = DBL_MAX;
@@ -610,7 +617,7 @@ const BWEB::Station * InformationManager::getEnemyMainBaseStation()
 }
 
 // Self, enemy, or neutral.
-BWAPI::Player InformationManager::getBaseOwner(BWTA::BaseLocation * base)
+BWAPI::Player InformationManager::getBaseOwner(BaseLocation * base)
 {
 	return _theBases[base]->owner;
 }
@@ -618,14 +625,14 @@ BWAPI::Player InformationManager::getBaseOwner(BWTA::BaseLocation * base)
 // If it's the enemy base, the depot will be null if it has not been seen.
 // If this is our base, there is still a chance that the depot may be null.
 // And if not null, the depot may be incomplete.
-BWAPI::Unit InformationManager::getBaseDepot(BWTA::BaseLocation * base)
+BWAPI::Unit InformationManager::getBaseDepot(BaseLocation * base)
 {
 	return _theBases[base]->resourceDepot;
 }
 
 // The natural base, whether it is taken or not.
 // May be null on some maps.
-BWTA::BaseLocation * InformationManager::getMyNaturalLocation()
+BaseLocation * InformationManager::getMyNaturalLocation()
 {
 	return _myNaturalBaseLocation;
 }
@@ -636,7 +643,7 @@ int InformationManager::getNumBases(BWAPI::Player player)
 {
 	int count = 0;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (_theBases[base]->owner == player)
 		{
@@ -652,7 +659,7 @@ int InformationManager::getNumFreeLandBases()
 {
 	int count = 0;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (_theBases[base]->owner == BWAPI::Broodwar->neutral() && !base->isIsland())
 		{
@@ -669,7 +676,7 @@ int InformationManager::getMyNumMineralPatches()
 {
 	int count = 0;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (_theBases[base]->owner == _self)
 		{
@@ -686,7 +693,7 @@ int InformationManager::getMyNumGeysers()
 {
 	int count = 0;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		BWAPI::Unit depot = _theBases[base]->resourceDepot;
 
@@ -708,7 +715,7 @@ void InformationManager::getMyGasCounts(int & nRefineries, int & nFreeGeysers)
 	int refineries = 0;
 	int geysers = 0;
 
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		BWAPI::Unit depot = _theBases[base]->resourceDepot;
 
@@ -981,7 +988,7 @@ void InformationManager::drawBaseInformation(int x, int y)
 
 	BWAPI::Broodwar->drawTextScreen(x, yy, "%cBases", white);
 
-	for (auto * base : BWTA::getBaseLocations())
+	for (auto * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		yy += 10;
 
@@ -1112,24 +1119,24 @@ const UnitData & InformationManager::getUnitData(BWAPI::Player player) const
     return _unitData.find(player)->second;
 }
 
-bool InformationManager::isBaseReserved(BWTA::BaseLocation * base)
+bool InformationManager::isBaseReserved(BaseLocation * base)
 {
 	return _theBases[base]->reserved;
 }
 
-void InformationManager::reserveBase(BWTA::BaseLocation * base)
+void InformationManager::reserveBase(BaseLocation * base)
 {
 	_theBases[base]->reserved = true;
 }
 
-void InformationManager::unreserveBase(BWTA::BaseLocation * base)
+void InformationManager::unreserveBase(BaseLocation * base)
 {
 	_theBases[base]->reserved = false;
 }
 
 void InformationManager::unreserveBase(BWAPI::TilePosition baseTilePosition)
 {
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (closeEnough(base->getTilePosition(), baseTilePosition))
 		{
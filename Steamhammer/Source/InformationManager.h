@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Common.h"
-#include "BWTA.h"
+#include "MapAnalysis.h"
 
 #include "Base.h"
 #include "UnitData.h"
@@ -32,10 +32,10 @@ class InformationManager
     bool            _enemyHasSiegeTech;
 
 	std::map<BWAPI::Player, UnitData>                   _unitData;
-	std::map<BWAPI::Player, BWTA::BaseLocation *>       _mainBaseLocations;
-	BWTA::BaseLocation *								_myNaturalBaseLocation;  // whether taken yet or not; may be null
-	std::map<BWAPI::Player, std::set<BWTA::Region *> >  _occupiedRegions;        // contains any building
-	std::map<BWTA::BaseLocation *, Base *>				_theBases;
+	std::map<BWAPI::Player, BaseLocation *>             _mainBaseLocations;
+	BaseLocation *										_myNaturalBaseLocation;  // whether taken yet or not; may be null
+	std::map<BWAPI::Player, std::set<Region *> >        _occupiedRegions;        // contains any building
+	std::map<BaseLocation *, Base *>					_theBases;
 	BWAPI::Unitset										_staticDefense;
 	const BWEB::Station *								_enemyBaseStation;
 	BWAPI::Unitset										_ourPylons;
@@ -48,11 +48,11 @@ class InformationManager
 
 	int                     getIndex(BWAPI::Player player) const;
 
-	void					baseInferred(BWTA::BaseLocation * base);
+	void					baseInferred(BaseLocation * base);
 	void					baseFound(BWAPI::Unit depot);
-	void					baseFound(BWTA::BaseLocation * base, BWAPI::Unit depot);
+	void					baseFound(BaseLocation * base, BWAPI::Unit depot);
 	void					baseLost(BWAPI::TilePosition basePosition);
-	void					baseLost(BWTA::BaseLocation * base);
+	void					baseLost(BaseLocation * base);
 	void					maybeAddBase(BWAPI::Unit unit);
 	bool					closeEnough(BWAPI::TilePosition a, BWAPI::TilePosition b);
 	void					chooseNewMainBase();
@@ -64,7 +64,7 @@ class InformationManager
     void                    updateBaseLocationInfo();
 	void					enemyBaseLocationFromOverlordSighting();
 	void					updateTheBases();
-	void                    updateOccupiedRegions(BWTA::Region * region, BWAPI::Player player);
+	void                    updateOccupiedRegions(Region * region, BWAPI::Player player);
 	void					updateGoneFromLastPosition();
 
 public:
@@ -80,7 +80,7 @@ public:
     void					onUnitRenegade(BWAPI::Unit unit)    { updateUnit(unit); }
     void					onUnitDestroy(BWAPI::Unit unit);
 
-	bool					isEnemyBuildingInRegion(BWTA::Region * region);
+	bool					isEnemyBuildingInRegion(Region * region);
     int						getNumUnits(BWAPI::UnitType type,BWAPI::Player player) const;
     bool					nearbyForceHasCloaked(BWAPI::Position p,BWAPI::Player player,int radius);
 
@@ -88,15 +88,15 @@ public:
 
     const UIMap &           getUnitInfo(BWAPI::Player player) const;
 
-	std::set<BWTA::Region *> &  getOccupiedRegions(BWAPI::Player player);
+	std::set<Region *> &	getOccupiedRegions(BWAPI::Player player);
 
-    BWTA::BaseLocation *    getMainBaseLocation(BWAPI::Player player);
-	BWTA::BaseLocation *	getMyMainBaseLocation();
-	BWTA::BaseLocation *	getEnemyMainBaseLocation();
+    BaseLocation *          getMainBaseLocation(BWAPI::Player player);
+	BaseLocation *			getMyMainBaseLocation();
+	BaseLocation *			getEnemyMainBaseLocation();
 	const BWEB::Station *	getEnemyMainBaseStation();
-	BWAPI::Player			getBaseOwner(BWTA::BaseLocation * base);
-	BWAPI::Unit 			getBaseDepot(BWTA::BaseLocation * base);
-	BWTA::BaseLocation *	getMyNaturalLocation();
+	BWAPI::Player			getBaseOwner(BaseLocation * base);
+	BWAPI::Unit 			getBaseDepot(BaseLocation * base);
+	BaseLocation *			getMyNaturalLocation();
 	int						getTotalNumBases() const;
 	int						getNumBases(BWAPI::Player player);
 	int						getNumFreeLandBases();
@@ -108,9 +108,9 @@ public:
 
 	void					maybeChooseNewMainBase();
 
-	bool					isBaseReserved(BWTA::BaseLocation * base);
-	void					reserveBase(BWTA::BaseLocation * base);
-	void					unreserveBase(BWTA::BaseLocation * base);
+	bool					isBaseReserved(BaseLocation * base);
+	void					reserveBase(BaseLocation * base);
+	void					unreserveBase(BaseLocation * base);
 	void					unreserveBase(BWAPI::TilePosition baseTilePosition);
 
 	int						getAir2GroundSupply(BWAPI::Player player) const;
@@ -147,6 +147,7 @@ public:
     const UnitData &        getUnitData(BWAPI::Player player) const;
 
     std::string             getEnemyName() const { return _enemyName; }
+    static std::string      NormalizedEnemyName();
 
     BWAPI::Position         predictUnitPosition(BWAPI::Unit unit, int frames) const;
 
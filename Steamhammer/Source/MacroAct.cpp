@@ -1,5 +1,6 @@
 #include "MacroAct.h"
 #include "BuildingManager.h"
+#include "UnitUtil.h"
 
 #include <regex>
 
@@ -531,7 +532,9 @@ void MacroAct::getCandidateProducers(std::vector<BWAPI::Unit> & candidates) cons
 
 	BWAPI::UnitType producerType = whatBuilds();
 
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
+	// Only units of the producer type. The type check below catches a unit that
+	// changed type earlier this frame.
+	for (const auto unit : UnitUtil::GetUnitsOfType(producerType))
 	{
 		// Reasons that a unit cannot produce the desired type:
 
@@ -618,7 +621,7 @@ bool MacroAct::hasPotentialProducer() const
 {
 	BWAPI::UnitType producerType = whatBuilds();
 
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
+	for (const auto unit : UnitUtil::GetUnitsOfType(producerType))
 	{
 		// A producer is good if it is the right type and doesn't suffer from
 		// any condition that makes it unable to produce for a long time.
@@ -0,0 +1,279 @@
+#include "MapAnalysis.h"
+
+using namespace UAlbertaBot;
+
+namespace { auto & bwemMap = BWEM::Map::Instance(); }
+
+BaseLocation::BaseLocation(const BWEM::Base * base, Region * region, bool island)
+	: _base(base)
+	, _region(region)
+	, _island(island)
+{
+}
+
+int BaseLocation::minerals() const
+{
+	int total = 0;
+	for (const BWEM::Mineral * mineral : _base->Minerals())
+	{
+		total += mineral->InitialAmount();
+	}
+	return total;
+}
+
+int BaseLocation::gas() const
+{
+	int total = 0;
+	for (const BWEM::Geyser * geyser : _base->Geysers())
+	{
+		total += geyser->InitialAmount();
+	}
+	return total;
+}
+
+// BWEM drops mined-out patches from the base, so this is up to date.
+BWAPI::Unitset BaseLocation::getMinerals() const
+{
+	BWAPI::Unitset result;
+	for (const BWEM::Mineral * mineral : _base->Minerals())
+	{
+		result.insert(mineral->Unit());
+	}
+	return result;
+}
+
+BWAPI::Unitset BaseLocation::getGeysers() const
+{
+	BWAPI::Unitset result;
+	for (const BWEM::Geyser * geyser : _base->Geysers())
+	{
+		result.insert(geyser->Unit());
+	}
+	return result;
+}
+
+double BaseLocation::getAirDistance(const BaseLocation * other) const
+{
+	return getPosition().getDistance(other->getPosition());
+}
+
+Chokepoint::Chokepoint(const BWEM::ChokePoint * choke)
+	: _choke(choke)
+{
+}
+
+BWAPI::Position Chokepoint::getCenter() const
+{
+	return BWAPI::Position(_choke->Center()) + BWAPI::Position(4, 4);
+}
+
+Region::Region(const BWEM::Area * area)
+	: _area(area)
+{
+}
+
+BWAPI::Position Region::getCenter() const
+{
+	return BWAPI::Position(_area->Top()) + BWAPI::Position(4, 4);
+}
+
+bool Region::isReachable(const Region * other) const
+{
+	return other && MapAnalysis::Instance().getGroupId(_area) == MapAnalysis::Instance().getGroupId(other->_area);
+}
+
+MapAnalysis & MapAnalysis::Instance()
+{
+	static MapAnalysis instance;
+	return instance;
+}
+
+// Initialization happens in initialize() below.
+MapAnalysis::MapAnalysis()
+	: _tileWidth(0)
+	, _tileHeight(0)
+{
+}
+
+void MapAnalysis::initialize()
+{
+	UAB_ASSERT(_regions.empty(), "map analysis already initialized");
+
+	// 1. One region per BWEM area. BWEM numbers its areas 1..n.
+	for (const BWEM::Area & area : bwemMap.Areas())
+	{
+		UAB_ASSERT(area.Id() == int(_regions.size()) + 1, "unexpected area id");
+		_regions.push_back(new Region(&area));
+	}
+
+	_tileWidth = bwemMap.Size().x;
+	_tileHeight = bwemMap.Size().y;
+	computeGroups();
+	computeTileData();
+
+	// 2. The chokepoints. Each one is listed by both of the areas it joins.
+	std::map<const BWEM::ChokePoint *, Chokepoint *> chokes;
+	for (Region * region : _regions)
+	{
+		for (const BWEM::ChokePoint * bwemChoke : region->getBWEMArea()->ChokePoints())
+		{
+			Chokepoint * & choke = chokes[bwemChoke];
+			if (!choke)
+			{
+				choke = new Chokepoint(bwemChoke);
+				_chokepoints.push_back(choke);
+			}
+			region->addChokepoint(choke);
+		}
+	}
+
+	// 3. The bases. Which ones are islands is filled in by computeIslands().
+	for (Region * region : _regions)
+	{
+		for (const BWEM::Base & bwemBase : region->getBWEMArea()->Bases())
+		{
+			BaseLocation * base = new BaseLocation(&bwemBase, region, false);
+			region->addBaseLocation(base);
+			_baseLocations.push_back(base);
+			if (base->isStartLocation())
+			{
+				_startLocations.push_back(base);
+			}
+		}
+	}
+	computeIslands();
+}
+
+void MapAnalysis::onBlockingNeutralDestroyed()
+{
+	computeGroups();
+	computeTileData();
+	computeIslands();
+}
+
+BaseLocation * MapAnalysis::getStartLocation(BWAPI::Player player) const
+{
+	const BWAPI::TilePosition tile = player->getStartLocation();
+
+	for (BaseLocation * base : _startLocations)
+	{
+		if (base->getTilePosition() == tile)
+		{
+			return base;
+		}
+	}
+
+	return nullptr;
+}
+
+// Number the connectivity groups: areas joined by a chokepoint that is not blocked by a
+// neutral are in the same group. At startup this is the same partition as BWEM's groups.
+void MapAnalysis::computeGroups()
+{
+	_areaGroupId.assign(_regions.size(), 0);
+
+	BWEM::Area::groupId nextGroup = 1;
+	std::vector<const BWEM::Area *> stack;
+	for (Region * region : _regions)
+	{
+		if (_areaGroupId[region->getBWEMArea()->Id() - 1] > 0)
+		{
+			continue;
+		}
+
+		_areaGroupId[region->getBWEMArea()->Id() - 1] = nextGroup;
+		stack.push_back(region->getBWEMArea());
+		while (!stack.empty())
+		{
+			const BWEM::Area * area = stack.back();
+			stack.pop_back();
+
+			for (const auto & neighbor : area->ChokePointsByArea())
+			{
+				if (_areaGroupId[neighbor.first->Id() - 1] > 0)
+				{
+					continue;
+				}
+				for (const BWEM::ChokePoint & choke : *neighbor.second)
+				{
+					if (!choke.Blocked())
+					{
+						_areaGroupId[neighbor.first->Id() - 1] = nextGroup;
+						stack.push_back(neighbor.first);
+						break;
+					}
+				}
+			}
+		}
+		++nextGroup;
+	}
+}
+
+// Fill in the per-tile area and group tables.
+// A tile that BWEM does not assign to a single area (unwalkable, or split between areas)
+// gets the area of the nearest tile that has one, by a breadth-first search from all
+// assigned tiles at once. That gives the same answer as BWEM's GetNearestArea() up to ties,
+// at the cost of one pass over the map instead of one search per tile.
+void MapAnalysis::computeTileData()
+{
+	_tileAreaId.assign(_tileWidth * _tileHeight, 0);
+	_tileGroupId.assign(_tileWidth * _tileHeight, 0);
+
+	std::vector<BWAPI::TilePosition> frontier;
+	for (int y = 0; y < _tileHeight; ++y)
+	{
+		for (int x = 0; x < _tileWidth; ++x)
+		{
+			BWAPI::TilePosition tile(x, y);
+			BWEM::Area::id id = bwemMap.GetTile(tile, BWEM::utils::check_t::no_check).AreaId();
+			if (id > 0)
+			{
+				_tileAreaId[tileIndex(tile)] = id;
+				frontier.push_back(tile);
+			}
+		}
+	}
+
+	// 8-connected, like BWEM's own nearest area search.
+	for (size_t i = 0; i < frontier.size(); ++i)
+	{
+		const BWAPI::TilePosition tile = frontier[i];
+		const BWEM::Area::id id = _tileAreaId[tileIndex(tile)];
+
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				BWAPI::TilePosition next(tile.x + dx, tile.y + dy);
+				if (onMap(next) && _tileAreaId[tileIndex(next)] == 0)
+				{
+					_tileAreaId[tileIndex(next)] = id;
+					frontier.push_back(next);
+				}
+			}
+		}
+	}
+
+	for (size_t i = 0; i < _tileAreaId.size(); ++i)
+	{
+		if (_tileAreaId[i] > 0)
+		{
+			_tileGroupId[i] = _areaGroupId[_tileAreaId[i] - 1];
+		}
+	}
+}
+
+// A base is an island if no starting location can walk to it.
+void MapAnalysis::computeIslands()
+{
+	std::set<BWEM::Area::groupId> startGroups;
+	for (const BWAPI::TilePosition & tile : bwemMap.StartingLocations())
+	{
+		startGroups.insert(getGroupId(tile));
+	}
+
+	for (BaseLocation * base : _baseLocations)
+	{
+		base->setIsland(startGroups.find(getGroupId(base->getRegion()->getBWEMArea())) == startGroups.end());
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <vector>
+
+#include "Common.h"
+
+// Map analysis queries for the rest of the bot: base locations, regions, chokepoints and ground connectivity.
+// Everything is backed by BWEM. The accessor names follow BWTA, which this replaced.
+
+namespace UAlbertaBot
+{
+
+class Region;
+
+class BaseLocation
+{
+	const BWEM::Base *	_base;
+	Region *			_region;
+	bool				_island;			// not connected by ground to any starting location
+
+public:
+
+	BaseLocation(const BWEM::Base * base, Region * region, bool island);
+
+	const BWEM::Base *	getBWEMBase() const { return _base; };
+
+	BWAPI::TilePosition	getTilePosition() const { return _base->Location(); };
+	BWAPI::Position		getPosition() const { return _base->Center(); };
+	Region *			getRegion() const { return _region; };
+
+	bool				isStartLocation() const { return _base->Starting(); };
+	bool				isIsland() const { return _island; };
+	void				setIsland(bool island) { _island = island; };
+	bool				isMineralOnly() const { return _base->Geysers().empty(); };
+
+	// The sum of the initial resources of the base's mineral patches and geysers.
+	int					minerals() const;
+	int					gas() const;
+
+	// The base's remaining mineral patches and its geysers.
+	BWAPI::Unitset		getMinerals() const;
+	BWAPI::Unitset		getGeysers() const;
+
+	double				getAirDistance(const BaseLocation * other) const;
+};
+
+class Chokepoint
+{
+	const BWEM::ChokePoint * _choke;
+
+public:
+
+	Chokepoint(const BWEM::ChokePoint * choke);
+
+	const BWEM::ChokePoint * getBWEMChokePoint() const { return _choke; };
+
+	BWAPI::Position		getCenter() const;
+};
+
+class Region
+{
+	const BWEM::Area *			_area;
+	std::vector<BaseLocation *>	_baseLocations;
+	std::vector<Chokepoint *>	_chokepoints;
+
+public:
+
+	Region(const BWEM::Area * area);
+
+	const BWEM::Area *	getBWEMArea() const { return _area; };
+
+	// The highest-altitude point of the region, the spot furthest from any unwalkable terrain.
+	BWAPI::Position		getCenter() const;
+
+	bool				isReachable(const Region * other) const;
+
+	const std::vector<BaseLocation *> & getBaseLocations() const { return _baseLocations; };
+	const std::vector<Chokepoint *> &	getChokepoints() const { return _chokepoints; };
+
+	void				addBaseLocation(BaseLocation * base) { _baseLocations.push_back(base); };
+	void				addChokepoint(Chokepoint * choke) { _chokepoints.push_back(choke); };
+};
+
+class MapAnalysis
+{
+	std::vector<Region *>		_regions;			// indexed by BWEM area id - 1
+	std::vector<Chokepoint *>	_chokepoints;
+	std::vector<BaseLocation *>	_baseLocations;
+	std::vector<BaseLocation *>	_startLocations;
+
+	// Per-tile lookup tables, indexed by tileIndex(). 0 means no area (only on maps with no areas at all).
+	int							_tileWidth;
+	int							_tileHeight;
+	std::vector<BWEM::Area::id>			_tileAreaId;		// the tile's area, or the nearest area if it is unwalkable
+	std::vector<BWEM::Area::groupId>	_tileGroupId;		// the connectivity group of that area
+
+	// Our own connectivity groups, indexed by BWEM area id - 1. BWEM computes its groups
+	// only at startup and leaves them stale when a blocking neutral is destroyed.
+	std::vector<BWEM::Area::groupId>	_areaGroupId;
+
+	MapAnalysis();
+
+	int		tileIndex(BWAPI::TilePosition tile) const { return tile.y * _tileWidth + tile.x; };
+	bool	onMap(BWAPI::TilePosition tile) const { return unsigned(tile.x) < unsigned(_tileWidth) && unsigned(tile.y) < unsigned(_tileHeight); };
+
+	void	computeGroups();
+	void	computeTileData();
+	void	computeIslands();
+
+public:
+
+	// Call after BWEM has finished analyzing the map.
+	void	initialize();
+
+	// Call after BWEM has been told about the loss of a neutral that may have blocked a path.
+	// BWEM gives the tiles under it to an area and unblocks its chokepoints, but does not
+	// update its connectivity groups. We recompute ours from the unblocked chokepoints.
+	void	onBlockingNeutralDestroyed();
+
+	const std::vector<BaseLocation *> &	getBaseLocations() const { return _baseLocations; };
+	const std::vector<BaseLocation *> &	getStartLocations() const { return _startLocations; };
+	const std::vector<Region *> &		getRegions() const { return _regions; };
+	const std::vector<Chokepoint *> &	getChokepoints() const { return _chokepoints; };
+
+	// Null if the player's start location is not known.
+	BaseLocation *	getStartLocation(BWAPI::Player player) const;
+
+	// The BWEM area id of the tile's region and the id of its connectivity group. 0 if off the map.
+	BWEM::Area::id		getAreaId(BWAPI::TilePosition tile) const { return onMap(tile) ? _tileAreaId[tileIndex(tile)] : 0; };
+	BWEM::Area::groupId	getGroupId(BWAPI::TilePosition tile) const { return onMap(tile) ? _tileGroupId[tileIndex(tile)] : 0; };
+	BWEM::Area::groupId	getGroupId(const BWEM::Area * area) const { return _areaGroupId[area->Id() - 1]; };
+
+	// The region containing the tile, or the nearest region if the tile is unwalkable.
+	// Null only for positions off the map.
+	Region *		getRegion(BWAPI::TilePosition tile) const
+	{
+		BWEM::Area::id id = getAreaId(tile);
+		return id > 0 ? _regions[id - 1] : nullptr;
+	};
+	Region *		getRegion(BWAPI::Position pos) const { return getRegion(BWAPI::TilePosition(pos)); };
+
+	// Whether a ground unit can walk from one tile to the other.
+	bool			isConnected(BWAPI::TilePosition a, BWAPI::TilePosition b) const
+	{
+		BWEM::Area::groupId group = getGroupId(a);
+		return group > 0 && group == getGroupId(b);
+	};
+
+	static MapAnalysis & Instance();
+};
+
+}
@@ -44,6 +44,10 @@ BWAPI::Position MapGrid::getLeastExplored(bool byGround)
 	double minSeenDist = 0;
 	int leastRow(0), leastCol(0);
 
+	const MapAnalysis & mapAnalysis = MapAnalysis::Instance();
+	const BWAPI::TilePosition homeTile = BWAPI::Broodwar->self()->getStartLocation();
+	const BWAPI::Position home(homeTile);
+
 	for (int r=0; r<rows; ++r)
 	{
 		for (int c=0; c<cols; ++c)
@@ -52,13 +56,11 @@ BWAPI::Position MapGrid::getLeastExplored(bool byGround)
 			BWAPI::Position cellCenter = getCellCenter(r,c);
 
 			// don't worry about places that aren't connected to our start location
-			if (byGround &&
-				!BWTA::isConnected(BWAPI::TilePosition(cellCenter), BWAPI::Broodwar->self()->getStartLocation()))
+			if (byGround && !mapAnalysis.isConnected(BWAPI::TilePosition(cellCenter), homeTile))
 			{
 				continue;
 			}
 
-			BWAPI::Position home(BWAPI::Broodwar->self()->getStartLocation());
 			double dist = home.getDistance(getCellByIndex(r, c).center);
             int lastVisited = getCellByIndex(r, c).timeLastVisited;
 			if (lastVisited < minSeen || ((lastVisited == minSeen) && (dist > minSeenDist)))
@@ -17,7 +17,7 @@ MapTools::MapTools()
 	setBWAPIMapData();
 
 	_hasIslandBases = false;
-	for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+	for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
 	{
 		if (base->isIsland())
 		{
@@ -249,7 +249,7 @@ void MapTools::drawHomeDistanceMap()
     }
 }
 
-BWTA::BaseLocation * MapTools::nextExpansion(bool hidden, bool wantMinerals, bool wantGas)
+BaseLocation * MapTools::nextExpansion(bool hidden, bool wantMinerals, bool wantGas)
 {
 	UAB_ASSERT(wantMinerals || wantGas, "unwanted expansion");
 
@@ -258,14 +258,14 @@ BWTA::BaseLocation * MapTools::nextExpansion(bool hidden, bool wantMinerals, boo
 	BWAPI::Player enemy = BWAPI::Broodwar->enemy();
 
 	// We'll go through the bases and pick the one with the best score.
-	BWTA::BaseLocation * bestBase = nullptr;
+	BaseLocation * bestBase = nullptr;
 	double bestScore = -999999.0;
 	
 	BWAPI::TilePosition homeTile = InformationManager::Instance().getMyMainBaseLocation()->getTilePosition();
 	BWAPI::Position myBasePosition(homeTile);
-	BWTA::BaseLocation * enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();  // may be null
+	BaseLocation * enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();  // may be null
 
-    for (BWTA::BaseLocation * base : BWTA::getBaseLocations())
+    for (BaseLocation * base : MapAnalysis::Instance().getBaseLocations())
     {
 		double score = 0.0;
 
@@ -385,7 +385,7 @@ BWTA::BaseLocation * MapTools::nextExpansion(bool hidden, bool wantMinerals, boo
 
 BWAPI::TilePosition MapTools::getNextExpansion(bool hidden, bool wantMinerals, bool wantGas)
 {
-	BWTA::BaseLocation * base = nextExpansion(hidden, wantMinerals, wantGas);
+	BaseLocation * base = nextExpansion(hidden, wantMinerals, wantGas);
 	if (base)
 	{
 		// BWAPI::Broodwar->printf("foresee base @ %d, %d", base->getTilePosition().x, base->getTilePosition().y);
@@ -396,7 +396,7 @@ BWAPI::TilePosition MapTools::getNextExpansion(bool hidden, bool wantMinerals, b
 
 BWAPI::TilePosition MapTools::reserveNextExpansion(bool hidden, bool wantMinerals, bool wantGas)
 {
-	BWTA::BaseLocation * base = nextExpansion(hidden, wantMinerals, wantGas);
+	BaseLocation * base = nextExpansion(hidden, wantMinerals, wantGas);
 	if (base)
 	{
 		// BWAPI::Broodwar->printf("reserve base @ %d, %d", base->getTilePosition().x, base->getTilePosition().y);
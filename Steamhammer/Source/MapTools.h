@@ -1,10 +1,10 @@
 #pragma once
 
-#include <BWTA.h>
 #include <vector>
 
 #include "Common.h"
 #include "DistanceMap.h"
+#include "MapAnalysis.h"
 
 // Keep track of map information, like what tiles are walkable or buildable.
 
@@ -31,7 +31,7 @@ class MapTools
 
     void				setBWAPIMapData();					// reads in the map data from bwapi and stores it in our map format
 
-	BWTA::BaseLocation *nextExpansion(bool hidden, bool wantMinerals, bool wantGas);
+	BaseLocation *	nextExpansion(bool hidden, bool wantMinerals, bool wantGas);
 
 public:
 
@@ -207,7 +207,7 @@ bool MicroManager::checkPositionWalkable(BWAPI::Position pos)
 
 bool MicroManager::unitNearChokepoint(BWAPI::Unit unit) const
 {
-	for (BWTA::Chokepoint * choke : BWTA::getChokepoints())
+	for (Chokepoint * choke : MapAnalysis::Instance().getChokepoints())
 	{
 		if (unit->getDistance(choke->getCenter()) < 80)
 		{
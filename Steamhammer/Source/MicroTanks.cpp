@@ -21,7 +21,7 @@ void MicroTanks::executeMicro(const BWAPI::Unitset & targets)
 	for (const auto tank : tanks)
 	{
         bool tankNearChokepoint = false; 
-        for (auto & choke : BWTA::getChokepoints())
+        for (auto & choke : MapAnalysis::Instance().getChokepoints())
         {
             if (choke->getCenter().getDistance(tank->getPosition()) < 64)
             {
@@ -0,0 +1,233 @@
+#include "MiningModel.h"
+
+#include <functional>
+#include <queue>
+
+using namespace UAlbertaBot;
+
+namespace
+{
+	// Each gather brings back this many minerals.
+	const double MineralsPerTrip = 8.0;
+
+	// Before any trips are seen: mining takes roughly this long, and starting, stopping
+	// and turning add a little to each leg of travel.
+	const double InitialMiningFrames = 75.0;
+	const double TravelOverheadFrames = 10.0;
+
+	// Weight of each new observation in the running estimates.
+	const double LearningRate = 0.2;
+
+	// A leg that takes longer than this was interrupted (the worker fought, fled, or was
+	// bumped off the patch), so it says nothing about the patch.
+	const int MaxLegFrames = 400;
+
+	// Observed income is measured over this many frames, one game minute.
+	const int ObservedIncomeFrames = 60 * 24;
+}
+
+MiningModel::MiningModel()
+	: _trips(0)
+{
+}
+
+void MiningModel::learn(double & estimate, int frames) const
+{
+	if (frames > 0 && frames <= MaxLegFrames)
+	{
+		estimate += LearningRate * (frames - estimate);
+	}
+}
+
+// Follow the worker through its trip by watching its order and whether it carries minerals.
+void MiningModel::observe(BWAPI::Unit worker, BWAPI::Unit patch, BWAPI::Unit depot)
+{
+	if (!worker || !patch || !depot || !patch->exists())
+	{
+		return;
+	}
+
+	const int now = BWAPI::Broodwar->getFrameCount();
+	const bool carrying = worker->isCarryingMinerals();
+	const BWAPI::Order order = worker->getOrder();
+
+	WorkerTrip & trip = _workers[worker];
+	if (trip.patch != patch)
+	{
+		// A new assignment. Start over at the next delivery.
+		trip = WorkerTrip();
+		trip.patch = patch;
+		trip.carrying = carrying;
+		return;
+	}
+
+	PatchTimes & times = patchTimes(patch, depot);
+
+	if (trip.carrying && !carrying)
+	{
+		// Delivered. That ends the return leg and starts the next trip.
+		_deliveries.push_back(now);
+		while (_deliveries.front() <= now - ObservedIncomeFrames)
+		{
+			_deliveries.pop_front();
+		}
+
+		if (trip.pickupFrame >= 0)
+		{
+			learn(times.returning, now - trip.pickupFrame);
+			if (trip.deliveredFrame >= 0 && trip.miningFrame >= 0)
+			{
+				++times.trips;
+				++_trips;
+			}
+		}
+		trip.deliveredFrame = now;
+		trip.arrivedFrame = -1;
+		trip.miningFrame = -1;
+		trip.pickupFrame = -1;
+	}
+	else if (!trip.carrying && carrying)
+	{
+		// Picked up the minerals.
+		if (trip.miningFrame >= 0)
+		{
+			learn(times.mining, now - trip.miningFrame);
+		}
+		trip.pickupFrame = now;
+	}
+	else if (!carrying && worker->getOrderTarget() == patch &&
+		(order == BWAPI::Orders::WaitForMinerals || order == BWAPI::Orders::MiningMinerals))
+	{
+		// At the patch. A worker that finds the patch free starts mining without waiting.
+		if (trip.arrivedFrame < 0)
+		{
+			trip.arrivedFrame = now;
+			if (trip.deliveredFrame >= 0)
+			{
+				learn(times.outbound, now - trip.deliveredFrame);
+			}
+		}
+		if (order == BWAPI::Orders::MiningMinerals && trip.miningFrame < 0)
+		{
+			trip.miningFrame = now;
+		}
+	}
+
+	trip.carrying = carrying;
+}
+
+MiningModel::PatchTimes & MiningModel::patchTimes(BWAPI::Unit patch, BWAPI::Unit depot)
+{
+	auto it = _patches.find(patch);
+	if (it != _patches.end())
+	{
+		return it->second;
+	}
+
+	// Estimate from the edge-to-edge distance at the worker's top speed.
+	PatchTimes & times = _patches[patch];
+	const double speed = BWAPI::Broodwar->self()->getRace().getWorker().topSpeed();
+	const double travel = (depot ? patch->getDistance(depot) : 0) / speed + TravelOverheadFrames;
+	times.outbound = travel;
+	times.returning = travel;
+	times.mining = InitialMiningFrames;
+	return times;
+}
+
+double MiningModel::getObservedMineralsPerMinute() const
+{
+	const int since = BWAPI::Broodwar->getFrameCount() - ObservedIncomeFrames;
+	int loads = 0;
+	for (auto it = _deliveries.rbegin(); it != _deliveries.rend() && *it > since; ++it)
+	{
+		++loads;
+	}
+	return loads * MineralsPerTrip;
+}
+
+// One worker delivers a load every round trip. More workers deliver proportionally more,
+// until the patch is mined nonstop; after that, extra workers only wait in line.
+double MiningModel::Income(const PatchTimes & times, int workers)
+{
+	if (workers <= 0 || times.mining <= 0.0)
+	{
+		return 0.0;
+	}
+	return MineralsPerTrip * std::min(workers / times.roundTrip(), 1.0 / times.mining);
+}
+
+double MiningModel::MarginalIncome(const PatchTimes & times, int workers)
+{
+	return Income(times, workers + 1) - Income(times, workers);
+}
+
+// -- -- -- -- -- -- -- -- -- -- --
+// MiningSimulator
+
+double MiningSimulator::MineralsPerMinute(const std::vector<MiningModel::PatchTimes> & patches, int workers, int frames, bool byMarginalIncome)
+{
+	if (patches.empty() || workers <= 0 || frames <= 0)
+	{
+		return 0.0;
+	}
+
+	// 1. Assign the workers. Ties go to the patch with fewer workers, then the shorter trip.
+	std::vector<int> count(patches.size(), 0);
+	std::vector<size_t> assignment;
+	for (int w = 0; w < workers; ++w)
+	{
+		size_t best = 0;
+		for (size_t i = 1; i < patches.size(); ++i)
+		{
+			const double gain = MiningModel::MarginalIncome(patches[i], count[i]);
+			const double bestGain = MiningModel::MarginalIncome(patches[best], count[best]);
+			bool better;
+			if (byMarginalIncome && std::abs(gain - bestGain) > 1e-9)
+			{
+				better = gain > bestGain;
+			}
+			else
+			{
+				better = count[i] < count[best] ||
+					(count[i] == count[best] && patches[i].roundTrip() < patches[best].roundTrip());
+			}
+			if (better)
+			{
+				best = i;
+			}
+		}
+		++count[best];
+		assignment.push_back(best);
+	}
+
+	// 2. Simulate. Workers start at the depot; each event is a worker arriving at its patch.
+	//    Workers take turns at a patch in the order they arrive.
+	typedef std::pair<int, int> Arrival;		// frame, worker
+	std::priority_queue<Arrival, std::vector<Arrival>, std::greater<Arrival>> arrivals;
+	for (int w = 0; w < workers; ++w)
+	{
+		arrivals.push(Arrival(int(patches[assignment[w]].outbound + 0.5), w));
+	}
+
+	std::vector<int> patchFreeFrame(patches.size(), 0);
+	int minerals = 0;
+	while (!arrivals.empty() && arrivals.top().first < frames)
+	{
+		const int w = arrivals.top().second;
+		const int frame = arrivals.top().first;
+		arrivals.pop();
+
+		const MiningModel::PatchTimes & times = patches[assignment[w]];
+		const int start = std::max(frame, patchFreeFrame[assignment[w]]);
+		patchFreeFrame[assignment[w]] = start + int(times.mining + 0.5);
+
+		const int delivered = patchFreeFrame[assignment[w]] + int(times.returning + 0.5);
+		if (delivered <= frames)
+		{
+			minerals += int(MineralsPerTrip);
+			arrivals.push(Arrival(delivered + int(times.outbound + 0.5), w));
+		}
+	}
+
+	return minerals * (60.0 * 24.0) / frames;
+}
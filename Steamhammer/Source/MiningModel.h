@@ -0,0 +1,101 @@
+#pragma once
+
+#include <deque>
+
+#include "Common.h"
+
+// Learned per-patch mining times, and the mineral income they predict.
+// A worker's trip has 3 legs: out from the depot to the patch, mining the patch, and back to
+// the depot with the minerals. Time spent waiting for another worker to finish the patch
+// is not part of any leg; the income model predicts it from the other workers on the patch.
+
+namespace UAlbertaBot
+{
+
+class MiningModel
+{
+public:
+
+	struct PatchTimes
+	{
+		double	outbound;		// frames from delivering minerals to arriving at the patch
+		double	mining;			// frames from starting to mine to picking up the minerals
+		double	returning;		// frames from picking up the minerals to delivering them
+		int		trips;			// observed trips; 0 means the times are estimated from distance
+
+		PatchTimes()
+			: outbound(0.0)
+			, mining(0.0)
+			, returning(0.0)
+			, trips(0)
+		{
+		}
+
+		// Frames for one worker's trip when it never has to wait.
+		double	roundTrip() const { return outbound + mining + returning; };
+	};
+
+private:
+
+	// What we have seen of one mineral worker's current trip. A frame is -1 if not seen yet.
+	struct WorkerTrip
+	{
+		BWAPI::Unit	patch;
+		bool		carrying;
+		int			deliveredFrame;
+		int			arrivedFrame;
+		int			miningFrame;
+		int			pickupFrame;
+
+		WorkerTrip()
+			: patch(nullptr)
+			, carrying(false)
+			, deliveredFrame(-1)
+			, arrivedFrame(-1)
+			, miningFrame(-1)
+			, pickupFrame(-1)
+		{
+		}
+	};
+
+	std::map<BWAPI::Unit, PatchTimes>	_patches;		// mineral patch -> times
+	std::map<BWAPI::Unit, WorkerTrip>	_workers;		// mineral worker -> current trip
+	int									_trips;			// observed trips over all patches
+	std::deque<int>						_deliveries;	// frames of recent deliveries, oldest first
+
+	void		learn(double & estimate, int frames) const;
+	PatchTimes &	patchTimes(BWAPI::Unit patch, BWAPI::Unit depot);
+
+public:
+
+	MiningModel();
+
+	// Call once per frame for each mineral worker with its assigned patch and depot.
+	void		observe(BWAPI::Unit worker, BWAPI::Unit patch, BWAPI::Unit depot);
+	void		workerRemoved(BWAPI::Unit worker) { _workers.erase(worker); };
+
+	// The learned times, or an estimate from the distance if the patch has no trips yet.
+	const PatchTimes &	getTimes(BWAPI::Unit patch, BWAPI::Unit depot) { return patchTimes(patch, depot); };
+
+	int			getTrips() const { return _trips; };
+
+	// Minerals per game minute actually delivered by the watched workers over the last minute.
+	double		getObservedMineralsPerMinute() const;
+
+	// Minerals per frame from a patch with the given number of workers,
+	// and the increase from adding one more worker.
+	static double	Income(const PatchTimes & times, int workers);
+	static double	MarginalIncome(const PatchTimes & times, int workers);
+};
+
+// Offline simulation of mining, to compare worker assignment policies.
+// It needs no game; feed it patch times from the model, or made-up ones.
+namespace MiningSimulator
+{
+	// Assign the workers one at a time, each to the patch with the highest marginal income
+	// (as WorkerData does), or each to the patch with the fewest workers (the old way).
+	// Then simulate the given number of frames and return minerals per game minute.
+	double	MineralsPerMinute(const std::vector<MiningModel::PatchTimes> & patches, int workers, int frames, bool byMarginalIncome);
+}
+
+}
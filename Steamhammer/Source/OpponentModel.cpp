@@ -449,13 +449,18 @@ OpponentModel::OpponentModel()
 	, _expectedEnemyPlan(OpeningPlan::Unknown)
 	, _recommendGasSteal(false)
 	, _worstCaseExpectedAirTech(INT_MAX)
+	, _fileRead(false)
+	, _fileBad(false)
 {
-	_filename = "om_" + InformationManager::Instance().getEnemyName() + ".txt";
+	// Don't construct the InformationManager here. The file may be read before the map is analyzed.
+	_filename = "om_" + InformationManager::NormalizedEnemyName() + ".txt";
 }
 
-// Read past game records from the opponent model file, and do initial analysis.
-void OpponentModel::read()
+// Read past game records from the opponent model file. No analysis.
+void OpponentModel::readFile()
 {
+	_fileRead = true;
+
 	if (Config::IO::ReadOpponentModel)
 	{
 		std::ifstream inFile(Config::IO::ReadDir + _filename);
@@ -463,6 +468,7 @@ void OpponentModel::read()
 		// There may not be a file to read. That's OK.
 		if (inFile.bad())
 		{
+			_fileBad = true;
 			return;
 		}
 
@@ -483,6 +489,20 @@ void OpponentModel::read()
 
 		inFile.close();
 	}
+}
+
+// Read past game records from the opponent model file, if not already done, and do initial analysis.
+void OpponentModel::read()
+{
+	if (!_fileRead)
+	{
+		readFile();
+	}
+
+	if (_fileBad)
+	{
+		return;
+	}
 
 	// Make immediate decisions that may take into account the game records.
 	// The initial expected enemy plan is set only here. That's the idea.
@@ -14,6 +14,8 @@ namespace UAlbertaBot
 		OpponentPlan _planRecognizer;
 
 		std::string _filename;
+		bool _fileRead;							// readFile() has been called
+		bool _fileBad;							// and the file could not be read
 		GameRecord _gameRecord;
 		std::vector<GameRecord *> _pastGameRecords;
 
@@ -45,6 +47,7 @@ namespace UAlbertaBot
 		void setOpening() { _gameRecord.setOpening(Config::Strategy::StrategyName); };
 		void setWin(bool isWinner) { _gameRecord.setWin(isWinner); };
 
+		void readFile();
 		void read();
 		void write();
 
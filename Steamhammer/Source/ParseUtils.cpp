@@ -17,8 +17,52 @@ using namespace UAlbertaBot;
 // Parse the JSON configuration file into Config:: variables.
 void ParseUtils::ParseConfigFile(const std::string & filename)
 {
-    rapidjson::Document doc;
+	rapidjson::Document doc;
 
+	if (ReadConfigFile(filename, doc))
+	{
+		ParseConfig(doc);
+	}
+}
+
+// Read the configuration file and parse the JSON, without setting any Config:: variables.
+// Return false if the file is missing or empty, or does not parse.
+bool ParseUtils::ReadConfigFile(const std::string & filename, rapidjson::Document & doc)
+{
+    std::string config = FileUtils::ReadFile(filename);
+
+    if (config.length() == 0)
+    {
+        return false;
+    }
+
+    Config::ConfigFile::ConfigFileFound = true;
+
+    bool parsingFailed = doc.Parse(config.c_str()).HasParseError();
+    return !parsingFailed;
+}
+
+// Parse only the IO options, which are needed to read the opponent model file.
+void ParseUtils::ParseIOOptions(const rapidjson::Document & doc)
+{
+	if (doc.HasMember("IO") && doc["IO"].IsObject())
+	{
+		const rapidjson::Value & io = doc["IO"];
+
+		JSONTools::ReadString("ReadDirectory", io, Config::IO::ReadDir);
+		JSONTools::ReadString("WriteDirectory", io, Config::IO::WriteDir);
+
+		JSONTools::ReadInt("MaxGameRecords", io, Config::IO::MaxGameRecords);
+
+		Config::IO::ReadOpponentModel = GetBoolByRace("ReadOpponentModel", io);
+		Config::IO::WriteOpponentModel = GetBoolByRace("WriteOpponentModel", io);
+	}
+}
+
+// Set the Config:: variables from a parsed configuration file.
+// The strategy options depend on the map analysis and the opponent model, so call this after those are ready.
+void ParseUtils::ParseConfig(const rapidjson::Document & doc)
+{
 	// Calculate our race and the matchup as C strings.
 	// The race is spelled out: Terran Protoss Zerg Unknown
 	// where "Unknown" means the enemy picked Random.
@@ -36,21 +80,6 @@ void ParseUtils::ParseConfigFile(const std::string & filename)
 	UAB_ASSERT(mapSize >= 2 && mapSize <= 8, "bad map size");
 	const std::string mapWeightString = std::string("Weight") + std::string("012345678").at(mapSize);
 
-    std::string config = FileUtils::ReadFile(filename);
-
-    if (config.length() == 0)
-    {
-        return;
-    }
-
-    Config::ConfigFile::ConfigFileFound = true;
-
-    bool parsingFailed = doc.Parse(config.c_str()).HasParseError();
-    if (parsingFailed)
-    {
-        return;
-    }
-
     // Parse the Bot Info
     if (doc.HasMember("Bot Info") && doc["Bot Info"].IsObject())
     {
@@ -81,6 +110,8 @@ void ParseUtils::ParseConfigFile(const std::string & filename)
 		Config::Micro::RetreatMeleeUnitShields = GetIntByRace("RetreatMeleeUnitShields", micro);
 		Config::Micro::RetreatMeleeUnitHP = GetIntByRace("RetreatMeleeUnitHP", micro);
 		Config::Micro::CombatSimRadius = GetIntByRace("CombatSimRadius", micro);
+		Config::Micro::CombatSimFramesPerTick = GetIntByRace("CombatSimFramesPerTick", micro);
+		Config::Micro::CombatSimDecisiveMargin = GetDoubleByRace("CombatSimDecisiveMargin", micro);
 		Config::Micro::UnitNearEnemyRadius = GetIntByRace("UnitNearEnemyRadius", micro);
 		Config::Micro::ScoutDefenseRadius = GetIntByRace("ScoutDefenseRadius", micro);
     }
@@ -90,12 +121,14 @@ void ParseUtils::ParseConfigFile(const std::string & filename)
     {
         const rapidjson::Value & macro = doc["Macro"];
         JSONTools::ReadInt("BOSSFrameLimit", macro, Config::Macro::BOSSFrameLimit);
+        JSONTools::ReadInt("FrameBudgetMs", macro, Config::Macro::FrameBudgetMs);
         JSONTools::ReadInt("PylonSpacing", macro, Config::Macro::PylonSpacing);
 
 		Config::Macro::ProductionJamFrameLimit = GetIntByRace("ProductionJamFrameLimit", macro);
 		Config::Macro::BuildingSpacing = GetIntByRace("BuildingSpacing", macro);
 		Config::Macro::WorkersPerRefinery = GetIntByRace("WorkersPerRefinery", macro);
 		Config::Macro::WorkersPerPatch = GetDoubleByRace("WorkersPerPatch", macro);
+		JSONTools::ReadBool("MineByMarginalIncome", macro, Config::Macro::MineByMarginalIncome);
 		// Config::Macro::ExpandToIslands = GetBoolByRace("ExpandToIslands", macro);
 	}
 
@@ -140,21 +173,11 @@ void ParseUtils::ParseConfigFile(const std::string & filename)
     }
 
 	// Parse the IO options.
-	if (doc.HasMember("IO") && doc["IO"].IsObject())
-	{
-		const rapidjson::Value & io = doc["IO"];
-
-		JSONTools::ReadString("ReadDirectory", io, Config::IO::ReadDir);
-		JSONTools::ReadString("WriteDirectory", io, Config::IO::WriteDir);
-
-		JSONTools::ReadInt("MaxGameRecords", io, Config::IO::MaxGameRecords);
-
-		Config::IO::ReadOpponentModel = GetBoolByRace("ReadOpponentModel", io);
-		Config::IO::WriteOpponentModel = GetBoolByRace("WriteOpponentModel", io);
-	}
+	ParseIOOptions(doc);
 
 	// We do this here because opening selection may depend on the results.
-	// File reading only happens if Config::IO::ReadOpponentModel is true.
+	// File reading only happens if Config::IO::ReadOpponentModel is true,
+	// and not at all if the file was already read.
 	OpponentModel::Instance().read();
 
     // Parse the Strategy options.
@@ -398,6 +421,7 @@ void ParseUtils::ParseTextCommand(const std::string & commandString)
         // Micro Options
         else if (variableName == "workersdefendrush") { Config::Micro::WorkersDefendRush = GetBoolFromString(val); }
 		else if (variableName == "combatsimradius") { Config::Micro::CombatSimRadius = GetIntFromString(val); }
+		else if (variableName == "combatsimframespertick") { Config::Micro::CombatSimFramesPerTick = GetIntFromString(val); }
         else if (variableName == "unitnearenemyradius") { Config::Micro::UnitNearEnemyRadius = GetIntFromString(val); }
 
         // Macro Options
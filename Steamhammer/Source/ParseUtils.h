@@ -8,6 +8,9 @@ namespace UAlbertaBot
 namespace ParseUtils
 {
     void ParseConfigFile(const std::string & filename);
+    bool ReadConfigFile(const std::string & filename, rapidjson::Document & doc);
+    void ParseIOOptions(const rapidjson::Document & doc);
+    void ParseConfig(const rapidjson::Document & doc);
     void ParseTextCommand(const std::string & commandLine);
     BWAPI::Race GetRace(const std::string & raceName);
 	
@@ -21,6 +21,11 @@ ProductionManager::ProductionManager()
 	, _extractorTrickUnitType			 (BWAPI::UnitTypes::None)
 	, _extractorTrickBuilding			 (nullptr)
 	, _workersReplacedInOpening			 (0)
+	, _readyFrame						 (0)
+	, _readyMinerals					 (0)
+	, _readyQueueChanges				 (0)
+	, _queueEvaluations					 (0)
+	, _skippedEvaluations				 (0)
 {
     setBuildOrder(StrategyManager::Instance().getOpeningBookBuildOrder());
 }
@@ -225,6 +230,15 @@ void ProductionManager::manageBuildOrderQueue()
 
 	updateGoals();
 
+	// If nothing can have changed since we last found that the top item can't be made, skip the work.
+	if (!queueNeedsEvaluation())
+	{
+		++_skippedEvaluations;
+		return;
+	}
+	_readyFrame = 0;
+	++_queueEvaluations;
+
 	// We do nothing if the queue is empty (obviously).
 	while (!_queue.isEmpty()) 
 	{
@@ -388,6 +402,10 @@ void ProductionManager::manageBuildOrderQueue()
 			_frameWhenDependendenciesMet = false;
 			_delayBuildingPredictionUntilFrame = 0;
 		}
+		else
+		{
+			predictReadiness(currentItem.macroAct, producer);
+		}
 
 		// TODO not much of a loop, eh? breaks on all branches
 		//      only commands and bug workarounds continue to the next item
@@ -504,6 +522,135 @@ void ProductionManager::maybeReorderQueue()
 	}
 }
 
+// Whether manageBuildOrderQueue() has to look at the queue this frame.
+// It can skip while a readiness prediction from predictReadiness() stands.
+bool ProductionManager::queueNeedsEvaluation() const
+{
+	return
+		_readyFrame == 0 ||
+		BWAPI::Broodwar->getFrameCount() >= _readyFrame ||
+		_queue.getChanges() != _readyQueueChanges ||
+		(_readyMinerals > 0 && getFreeMinerals() >= _readyMinerals);
+}
+
+// The top item of the queue could not be made this frame. Predict the earliest frame that
+// looking at the queue again could make a difference, and set _readyFrame to it.
+// Be conservative: Leave _readyFrame at 0 (look every frame) when unsure.
+// Unit events, queue changes, and free minerals reaching the price end the wait early,
+// so the income prediction can be rough. The frame-based jam checks are never skipped.
+void ProductionManager::predictReadiness(const MacroAct & act, BWAPI::Unit producer)
+{
+	const int now = BWAPI::Broodwar->getFrameCount();
+
+	_readyFrame = 0;
+	_readyMinerals = 0;
+
+	// Commands happen at once. Buildings send a worker ahead of time, which needs a look every frame.
+	if (act.isCommand() || act.isBuilding())
+	{
+		return;
+	}
+
+	// While we can't pay the minerals for the top item, nothing in the queue can happen:
+	// The item can't be made, and maybeReorderQueue() needs more than its mineral price.
+	const int minerals = getFreeMinerals();
+	const int gas = getFreeGas();
+	const bool mineralsShort = act.mineralPrice(false) > minerals;
+
+	// Without a producer, wait until one is free. With minerals in hand, a later
+	// queue item might be pulled to the front any time, so only wait if there is none.
+	int producerFrames = 0;
+	if (!producer)
+	{
+		producerFrames = framesUntilProducerFree(act);
+		if (producerFrames <= 0 || (!mineralsShort && _queue.size() >= 2))
+		{
+			return;
+		}
+	}
+	else if (!mineralsShort)
+	{
+		// Blocked on something else, like supply.
+		return;
+	}
+
+	// These are the same income rates that WorkerManager uses to time builders.
+	const double mineralRate = WorkerManager::Instance().getNumMineralWorkers() * 0.045;
+	const double gasRate = WorkerManager::Instance().getNumGasWorkers() * 0.07;
+
+	const int jamFrameLimit = Config::Macro::ProductionJamFrameLimit;
+	int readyFrame = now + producerFrames;
+
+	if (mineralsShort)
+	{
+		_readyMinerals = act.mineralPrice(false);
+		readyFrame = std::max(readyFrame, mineralRate > 0.0
+			? now + int(std::ceil((act.mineralPrice(false) - minerals) / mineralRate))
+			: now + jamFrameLimit);
+	}
+	if (act.gasPrice(false) > gas)
+	{
+		readyFrame = std::max(readyFrame, gasRate > 0.0
+			? now + int(std::ceil((act.gasPrice(false) - gas) / gasRate))
+			: now + jamFrameLimit);
+	}
+
+	// Look again in time for the frame-based checks in manageBuildOrderQueue():
+	// the skip of blocked items out of book, and the jam warning and jam break.
+	// The jam limit is scaled by 1, 2 or 4 depending on the situation; allow for each.
+	if (_outOfBook)
+	{
+		readyFrame = std::min(readyFrame, _lastProductionFrame + 49);
+	}
+	for (int scale = 1; scale <= 4; scale *= 2)
+	{
+		const int warningFrame = _lastProductionFrame + (scale * jamFrameLimit) / 2;
+		if (warningFrame > now)
+		{
+			readyFrame = std::min(readyFrame, warningFrame);
+		}
+		readyFrame = std::min(readyFrame, _lastProductionFrame + scale * jamFrameLimit + 1);
+	}
+
+	// Not worth it for a frame or two.
+	if (readyFrame <= now + 1)
+	{
+		_readyMinerals = 0;
+		return;
+	}
+
+	_readyFrame = readyFrame;
+	_readyQueueChanges = _queue.getChanges();
+}
+
+// The number of frames until a unit that can produce the act finishes its current work,
+// or 0 if we can't tell. Units that are still being built or are unpowered will produce
+// a unit event when they become available, so they are left out.
+int ProductionManager::framesUntilProducerFree(const MacroAct & act) const
+{
+	const BWAPI::UnitType producerType = act.whatBuilds();
+
+	int frames = INT_MAX;
+	for (const auto unit : UnitUtil::GetUnitsOfType(producerType))
+	{
+		if (unit->getType() != producerType || !unit->isCompleted() || !unit->isPowered())
+		{
+			continue;
+		}
+
+		const int remaining = std::max(unit->getRemainingTrainTime(),
+			std::max(unit->getRemainingResearchTime(), unit->getRemainingUpgradeTime()));
+		if (unit->isLifted() || remaining <= 0)
+		{
+			// Idle, yet not a producer for some reason. Don't guess.
+			return 0;
+		}
+		frames = std::min(frames, remaining);
+	}
+
+	return frames == INT_MAX ? 0 : frames;
+}
+
 // Return null if no producer is found.
 // NOTE closestTo defaults to BWAPI::Positions::None, meaning we don't care.
 BWAPI::Unit ProductionManager::getProducer(MacroAct act, BWAPI::Position closestTo) const
@@ -590,16 +737,7 @@ BWAPI::Unit ProductionManager::getFarthestUnitFromPosition(const std::vector<BWA
 
 BWAPI::Unit ProductionManager::getClosestLarvaToPosition(BWAPI::Position closestTo) const
 {
-	std::vector<BWAPI::Unit> larvas;
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
-	{
-		if (unit->getType() == BWAPI::UnitTypes::Zerg_Larva)
-		{
-			larvas.push_back(unit);
-		}
-	}
-
-	return getClosestUnitToPosition(larvas, closestTo);
+	return getClosestUnitToPosition(UnitUtil::GetUnitsOfType(BWAPI::UnitTypes::Zerg_Larva), closestTo);
 }
 
 // Create a unit or start research.
@@ -616,6 +754,7 @@ void ProductionManager::create(BWAPI::Unit producer, const BuildOrderItem & item
 	if (act.isAddon())
 	{
 		producer->buildAddon(act.getUnitType());
+		UnitUtil::InvalidateUnitCounts();
 	}
 	// If it's a building other than an add-on.
 	else if (act.isBuilding()                                    // implies act.isUnit()
@@ -627,26 +766,7 @@ void ProductionManager::create(BWAPI::Unit producer, const BuildOrderItem & item
 			InformationManager::Instance().maybeChooseNewMainBase();
 		}
 
-		// By default, build in the main base.
-		// BuildingManager will override the location if it needs to.
-		// Otherwise it will find some spot near desiredLocation.
-		BWAPI::TilePosition desiredLocation = InformationManager::Instance().getMyMainBaseLocation()->getTilePosition();
-
-		if (act.getMacroLocation() == MacroLocation::Natural ||
-			act.getMacroLocation() == MacroLocation::Wall)
-		{
-			BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
-			if (natural)
-			{
-				desiredLocation = natural->getTilePosition();
-			}
-		}
-		else if (act.getMacroLocation() == MacroLocation::Center)
-		{
-			// Near the center of the map.
-			desiredLocation = BWAPI::TilePosition(BWAPI::Broodwar->mapWidth()/2, BWAPI::Broodwar->mapHeight()/2);
-		}
-		
+		BWAPI::TilePosition desiredLocation = getDesiredBuildingLocation(act);
 		BuildingManager::Instance().addBuildingTask(act, desiredLocation, item.isWorkerScoutBuilding);
 	}
 	// if we're dealing with a non-building unit, or a morphed zerg building
@@ -662,6 +782,7 @@ void ProductionManager::create(BWAPI::Unit producer, const BuildOrderItem & item
 			// if not, train the unit
 			producer->train(act.getUnitType());
 		}
+		UnitUtil::InvalidateUnitCounts();
 	}
 	// if we're dealing with a tech research
 	else if (act.isTech())
@@ -719,6 +840,61 @@ bool ProductionManager::canMakeNow(BWAPI::Unit producer, MacroAct t)
 	return canMake;
 }
 
+// Where to try to place a building, before BuildingManager has its say.
+BWAPI::TilePosition ProductionManager::getDesiredBuildingLocation(const MacroAct & act) const
+{
+	// By default, build in the main base.
+	// BuildingManager will override the location if it needs to.
+	// Otherwise it will find some spot near desiredLocation.
+	BWAPI::TilePosition desiredLocation = InformationManager::Instance().getMyMainBaseLocation()->getTilePosition();
+
+	if (act.getMacroLocation() == MacroLocation::Natural ||
+		act.getMacroLocation() == MacroLocation::Wall)
+	{
+		BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+		if (natural)
+		{
+			desiredLocation = natural->getTilePosition();
+		}
+	}
+	else if (act.getMacroLocation() == MacroLocation::Center)
+	{
+		// Near the center of the map.
+		desiredLocation = BWAPI::TilePosition(BWAPI::Broodwar->mapWidth()/2, BWAPI::Broodwar->mapHeight()/2);
+	}
+
+	return desiredLocation;
+}
+
+// Pass the upcoming buildings in the queue to BuildingManager, so it can find and reserve
+// their locations ahead of time, on frames that have time to spare.
+void ProductionManager::prefetchBuildingLocations(int msAvailable)
+{
+	const int lookAhead = 4;
+
+	std::vector<Building> upcoming;
+	for (int i = int(_queue.size()) - 1; i >= std::max(0, int(_queue.size()) - lookAhead); --i)
+	{
+		const BuildOrderItem item = _queue[i];
+		const MacroAct & act = item.macroAct;
+
+		if (act.isBuilding() &&
+			!UnitUtil::IsMorphedBuildingType(act.getUnitType()) &&
+			act.whatBuilds().isWorker())
+		{
+			Building b(act.getUnitType(), getDesiredBuildingLocation(act));
+			b.macroAct = act;
+			b.macroLocation = act.getMacroLocation();
+			b.isWorkerScoutBuilding = item.isWorkerScoutBuilding;
+			if (act.hasReservedPosition())
+				b.finalPosition = act.getReservedPosition();
+			upcoming.push_back(b);
+		}
+	}
+
+	BuildingManager::Instance().prefetchBuildingLocations(upcoming, msAvailable);
+}
+
 // When the next item in the _queue is a building, this checks to see if we should move to
 // its location in preparation for construction. If so, it orders the move.
 // This function is here as it needs to access prodction manager's reserved resources info.
@@ -1123,6 +1299,7 @@ void ProductionManager::doExtractorTrick()
 					else
 					{
 						larva->morph(_extractorTrickUnitType);
+						UnitUtil::InvalidateUnitCounts();
 					}
 					_extractorTrickState = ExtractorTrick::UnitOrdered;
 				}
@@ -1158,6 +1335,7 @@ void ProductionManager::doExtractorTrick()
 			getFreeGas() >= _extractorTrickUnitType.gasPrice())
 		{
 			larva->morph(_extractorTrickUnitType);
+			UnitUtil::InvalidateUnitCounts();
 			_extractorTrickState = ExtractorTrick::None;
 		}
 	}
@@ -35,6 +35,14 @@ class ProductionManager
 	Building *			_extractorTrickBuilding;         // set depending on the extractor trick state
 
 	int					_workersReplacedInOpening; // How many workers we have attempted to replace during the opening
+
+	// Readiness model. When the top item can't be made yet, predict when it may become possible,
+	// and don't look at the queue again until then, or until something happens that could change it.
+	int					_readyFrame;                     // 0 if we have no prediction and look every frame
+	int					_readyMinerals;                  // also look when free minerals reach this; 0 if unused
+	int					_readyQueueChanges;              // also look when the queue changes
+	int					_queueEvaluations;
+	int					_skippedEvaluations;
     
 	BWAPI::Unit         getClosestUnitToPosition(const std::vector<BWAPI::Unit> & units, BWAPI::Position closestTo) const;
 	BWAPI::Unit         getFarthestUnitFromPosition(const std::vector<BWAPI::Unit> & units, BWAPI::Position farthest) const;
@@ -48,8 +56,12 @@ class ProductionManager
 	bool				itemCanBeProduced(const MacroAct & act) const;
 	void                manageBuildOrderQueue();
 	void				maybeReorderQueue();
+	bool				queueNeedsEvaluation() const;
+	void				predictReadiness(const MacroAct & act, BWAPI::Unit producer);
+	int					framesUntilProducerFree(const MacroAct & act) const;
     bool                canMakeNow(BWAPI::Unit producer,MacroAct t);
     void                predictWorkerMovement(const Building & b);
+	BWAPI::TilePosition	getDesiredBuildingLocation(const MacroAct & act) const;
 
     int                 getFreeMinerals() const;
     int                 getFreeGas() const;
@@ -68,6 +80,8 @@ public:
 	void	update();
 	void	onUnitMorph(BWAPI::Unit unit);
 	void	onUnitDestroy(BWAPI::Unit unit);
+	void	wakeUp() { _readyFrame = 0; };      // call on any unit event
+	void	prefetchBuildingLocations(int msAvailable);
 	void	drawProductionInformation(int x, int y);
 	void	startExtractorTrick(BWAPI::UnitType type);
 
@@ -81,6 +95,9 @@ public:
 	bool	isOutOfBook() const { return _outOfBook; };
 
     void    cancelHighestPriorityItem();
+
+	int		getQueueEvaluations() const { return _queueEvaluations; };
+	int		getSkippedEvaluations() const { return _skippedEvaluations; };
 };
 
 
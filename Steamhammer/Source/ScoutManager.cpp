@@ -41,7 +41,7 @@ ScoutManager & ScoutManager::Instance()
 // Guarantee: We only set a target if the scout for the target is set.
 void ScoutManager::setScoutTargets()
 {
-	BWTA::BaseLocation * enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
+	BaseLocation * enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
 	if (enemyBase)
 	{
 		_overlordScoutTarget = BWAPI::TilePositions::Invalid;
@@ -175,8 +175,8 @@ void ScoutManager::update()
 	if (_workerScout)
 	{
 		// Keep track of when we've last scouted the enemy base
-		BWTA::BaseLocation* enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
-		if (enemyBase && BWTA::getRegion(BWAPI::TilePosition(_workerScout->getPosition())) == enemyBase->getRegion())
+		BaseLocation* enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
+		if (enemyBase && MapAnalysis::Instance().getRegion(BWAPI::TilePosition(_workerScout->getPosition())) == enemyBase->getRegion())
 		{
 			_enemyBaseLastSeen = BWAPI::Broodwar->getFrameCount();
 		}
@@ -323,7 +323,7 @@ void ScoutManager::moveGroundScout(BWAPI::Unit scout)
 	}
 	else
 	{
-		const BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+		const BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
 		UAB_ASSERT(enemyBaseLocation, "no enemy base");
 
@@ -389,7 +389,7 @@ void ScoutManager::moveAirScout(BWAPI::Unit scout)
 {
 	// get the enemy base location, if we have one
 	// Note: In case of an enemy proxy or weird map, this might be our own base. Roll with it.
-	const BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+	const BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
 	if (enemyBaseLocation)
 	{
@@ -461,7 +461,7 @@ void ScoutManager::followPerimeter()
 // false if the caller gets control.
 bool ScoutManager::gasSteal()
 {
-	BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+	BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 	if (!enemyBaseLocation)
 	{
 		_gasStealStatus = "Enemy base not found";
@@ -557,7 +557,7 @@ BWAPI::Unit ScoutManager::enemyWorkerToHarass() const
 // Find an enemy geyser and return it, if there is one.
 BWAPI::Unit ScoutManager::getAnyEnemyGeyser() const
 {
-	BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+	BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
 	BWAPI::Unitset geysers = enemyBaseLocation->getGeysers();
 	if (geysers.size() > 0)
@@ -573,7 +573,7 @@ BWAPI::Unit ScoutManager::getAnyEnemyGeyser() const
 // If 0 we can't steal it, and if >1 then it's no use to steal one.
 BWAPI::Unit ScoutManager::getTheEnemyGeyser() const
 {
-	BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+	BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
 	BWAPI::Unitset geysers = enemyBaseLocation->getGeysers();
 	if (geysers.size() == 1)
@@ -626,7 +626,7 @@ BWAPI::Position ScoutManager::getFleePosition()
 {
     UAB_ASSERT_WARNING(!_enemyRegionVertices.empty(), "should have enemy region vertices");
     
-    BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+    BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
     // if this is the first flee, we will not have a previous perimeter index
     if (_currentRegionVertexIndex == -1)
@@ -666,14 +666,14 @@ BWAPI::Position ScoutManager::getFleePosition()
 //      while remaining safe.
 void ScoutManager::calculateEnemyRegionVertices()
 {
-    BWTA::BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
+    BaseLocation * enemyBaseLocation = InformationManager::Instance().getEnemyMainBaseLocation();
 
     if (!enemyBaseLocation)
     {
         return;
     }
 
-    BWTA::Region * enemyRegion = enemyBaseLocation->getRegion();
+    Region * enemyRegion = enemyBaseLocation->getRegion();
 
     if (!enemyRegion)
     {
@@ -683,75 +683,90 @@ void ScoutManager::calculateEnemyRegionVertices()
 	const BWAPI::Position enemyCenter = BWAPI::Position(enemyBaseLocation->getTilePosition()) + BWAPI::Position(64, 48);
 
     const BWAPI::Position basePosition = BWAPI::Position(BWAPI::Broodwar->self()->getStartLocation());
-    const std::vector<BWAPI::TilePosition> & closestTobase = MapTools::Instance().getClosestTilesTo(basePosition);
+
+	const MapAnalysis & mapAnalysis = MapAnalysis::Instance();
+	const BWEM::Area::id enemyAreaId = enemyRegion->getBWEMArea()->Id();
+
+	// The region's tiles all lie within its bounding box, give or take a tile for tiles
+	// shared with a neighbouring area. Scan it once in row order.
+	const BWAPI::TilePosition topLeft = enemyRegion->getBWEMArea()->TopLeft() - BWAPI::TilePosition(1, 1);
+	const BWAPI::TilePosition bottomRight = enemyRegion->getBWEMArea()->BottomRight() + BWAPI::TilePosition(1, 1);
 
     std::set<BWAPI::Position> unsortedVertices;
 
     // check each tile position
-	for (size_t i(0); i < closestTobase.size(); ++i)
+	for (int ty = topLeft.y; ty <= bottomRight.y; ++ty)
 	{
-		const BWAPI::TilePosition & tp = closestTobase[i];
-
-		if (BWTA::getRegion(tp) != enemyRegion)
+		for (int tx = topLeft.x; tx <= bottomRight.x; ++tx)
 		{
-			continue;
-		}
+			const BWAPI::TilePosition tp(tx, ty);
 
-		// a tile is 'on an edge' unless
-		// 1) in all 4 directions there's a tile position in the current region
-		// 2) in all 4 directions there's a buildable tile
-		bool edge =
-			   BWTA::getRegion(BWAPI::TilePosition(tp.x + 1, tp.y)) != enemyRegion || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x + 1, tp.y))
-			|| BWTA::getRegion(BWAPI::TilePosition(tp.x, tp.y + 1)) != enemyRegion || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x, tp.y + 1))
-			|| BWTA::getRegion(BWAPI::TilePosition(tp.x - 1, tp.y)) != enemyRegion || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x - 1, tp.y))
-			|| BWTA::getRegion(BWAPI::TilePosition(tp.x, tp.y - 1)) != enemyRegion || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x, tp.y - 1));
-
-		// push the tiles that aren't surrounded
-		if (edge && BWAPI::Broodwar->isBuildable(tp))
-		{
-			if (Config::Debug::DrawScoutInfo)
+			if (mapAnalysis.getAreaId(tp) != enemyAreaId || !BWAPI::Broodwar->isBuildable(tp))
 			{
-				int x1 = tp.x * 32 + 2;
-				int y1 = tp.y * 32 + 2;
-				int x2 = (tp.x + 1) * 32 - 2;
-				int y2 = (tp.y + 1) * 32 - 2;
-
-				BWAPI::Broodwar->drawTextMap(x1 + 3, y1 + 2, "%d", MapTools::Instance().getGroundTileDistance(BWAPI::Position(tp), basePosition));
-				BWAPI::Broodwar->drawBoxMap(x1, y1, x2, y2, BWAPI::Colors::Green, false);
+				continue;
 			}
 
-			BWAPI::Position vertex = BWAPI::Position(tp) + BWAPI::Position(16, 16);
-
-			// Pull the vertex towards the enemy base center, unless it is already within 12 tiles
-			double dist = enemyCenter.getDistance(vertex);
-			if (dist > 384.0)
+			// a tile is 'on an edge' unless
+			// 1) in all 4 directions there's a tile position in the current region
+			// 2) in all 4 directions there's a buildable tile
+			bool edge =
+				   mapAnalysis.getAreaId(BWAPI::TilePosition(tp.x + 1, tp.y)) != enemyAreaId || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x + 1, tp.y))
+				|| mapAnalysis.getAreaId(BWAPI::TilePosition(tp.x, tp.y + 1)) != enemyAreaId || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x, tp.y + 1))
+				|| mapAnalysis.getAreaId(BWAPI::TilePosition(tp.x - 1, tp.y)) != enemyAreaId || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x - 1, tp.y))
+				|| mapAnalysis.getAreaId(BWAPI::TilePosition(tp.x, tp.y - 1)) != enemyAreaId || !BWAPI::Broodwar->isBuildable(BWAPI::TilePosition(tp.x, tp.y - 1));
+
+			// push the tiles that aren't surrounded
+			if (edge)
 			{
-				double pullBy = std::min(dist - 384.0, 120.0);
-
-				// Special case where the slope is infinite
-				if (vertex.x == enemyCenter.x)
+				if (Config::Debug::DrawScoutInfo)
 				{
-					vertex = vertex + BWAPI::Position(0, vertex.y > enemyCenter.y ? -pullBy : pullBy);
-				}
-				else
-				{
-					// First get the slope, m = (y1 - y0)/(x1 - x0)
-					double m = double(enemyCenter.y - vertex.y) / double(enemyCenter.x - vertex.x);
+					int x1 = tp.x * 32 + 2;
+					int y1 = tp.y * 32 + 2;
+					int x2 = (tp.x + 1) * 32 - 2;
+					int y2 = (tp.y + 1) * 32 - 2;
 
-					// Now the equation for a new x is x0 +- d/sqrt(1 + m^2)
-					double x = vertex.x + (vertex.x > enemyCenter.x ? -1.0 : 1.0) * pullBy / (sqrt(1 + m * m));
+					BWAPI::Broodwar->drawTextMap(x1 + 3, y1 + 2, "%d", MapTools::Instance().getGroundTileDistance(BWAPI::Position(tp), basePosition));
+					BWAPI::Broodwar->drawBoxMap(x1, y1, x2, y2, BWAPI::Colors::Green, false);
+				}
 
-					// And y is m(x - x0) + y0
-					double y = m * (x - vertex.x) + vertex.y;
+				BWAPI::Position vertex = BWAPI::Position(tp) + BWAPI::Position(16, 16);
 
-					vertex = BWAPI::Position(x, y);
+				// Pull the vertex towards the enemy base center, unless it is already within 12 tiles
+				double dist = enemyCenter.getDistance(vertex);
+				if (dist > 384.0)
+				{
+					double pullBy = std::min(dist - 384.0, 120.0);
+
+					// Special case where the slope is infinite
+					if (vertex.x == enemyCenter.x)
+					{
+						vertex = vertex + BWAPI::Position(0, vertex.y > enemyCenter.y ? -pullBy : pullBy);
+					}
+					else
+					{
+						// First get the slope, m = (y1 - y0)/(x1 - x0)
+						double m = double(enemyCenter.y - vertex.y) / double(enemyCenter.x - vertex.x);
+
+						// Now the equation for a new x is x0 +- d/sqrt(1 + m^2)
+						double x = vertex.x + (vertex.x > enemyCenter.x ? -1.0 : 1.0) * pullBy / (sqrt(1 + m * m));
+
+						// And y is m(x - x0) + y0
+						double y = m * (x - vertex.x) + vertex.y;
+
+						vertex = BWAPI::Position(x, y);
+					}
 				}
-			}
 
-			unsortedVertices.insert(vertex);
+				unsortedVertices.insert(vertex);
+			}
 		}
 	}
 
+	if (unsortedVertices.empty())
+	{
+		return;
+	}
+
     std::vector<BWAPI::Position> sortedVertices;
     BWAPI::Position current = *unsortedVertices.begin();
 
@@ -850,7 +865,7 @@ void ScoutManager::calculateEnemyRegionVertices()
 bool ScoutManager::pylonHarass()
 {
 	// If we haven't found the enemy base yet, we can't do any pylon harass
-    BWTA::BaseLocation* enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
+    BaseLocation* enemyBase = InformationManager::Instance().getEnemyMainBaseLocation();
     const BWEB::Station * enemyStation = InformationManager::Instance().getEnemyMainBaseStation();
     if (!enemyBase || !enemyStation) return false;
 
@@ -886,7 +901,7 @@ bool ScoutManager::pylonHarass()
 		// - We are in sight range of an enemy building
 		// - Nothing is in the way
 
-        if (BWTA::getRegion(BWAPI::TilePosition(_workerScout->getPosition())) != enemyBase->getRegion()) return false;
+        if (MapAnalysis::Instance().getRegion(BWAPI::TilePosition(_workerScout->getPosition())) != enemyBase->getRegion()) return false;
 
 		if (BWAPI::Broodwar->self()->minerals() - BuildingManager::Instance().getReservedMinerals() < 100) return false;
 
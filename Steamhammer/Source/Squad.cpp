@@ -17,6 +17,8 @@ Squad::Squad()
 	, _attackAtMax(false)
     , _lastRetreatSwitch(0)
     , _lastRetreatSwitchVal(false)
+	, _combatSimPhase(0)
+	, _combatSimFrame(0)
     , _priority(0)
 {
     int a = 10;   // only you can prevent linker errors
@@ -38,6 +40,8 @@ Squad::Squad(const std::string & name, SquadOrder order, size_t priority)
 	, _attackAtMax(false)
 	, _lastRetreatSwitch(0)
     , _lastRetreatSwitchVal(false)
+	, _combatSimPhase(0)
+	, _combatSimFrame(0)
     , _priority(priority)
 {
 	setSquadOrder(order);
@@ -357,7 +361,7 @@ bool Squad::needsToRegroup()
 	const int retreatDuration = 2 * 24;
 	bool retreat = _lastRetreatSwitchVal && (BWAPI::Broodwar->getFrameCount() - _lastRetreatSwitch < retreatDuration);
 
-	if (!retreat)
+	if (!retreat && Config::Micro::CombatSimFramesPerTick <= 0)
 	{
 		// All other checks are done. Finally do the expensive combat simulation.
 		CombatSimulation sim;
@@ -370,6 +374,36 @@ bool Squad::needsToRegroup()
 		_lastRetreatSwitchVal = retreat;
 
 	}
+	else if (!retreat)
+	{
+		// The same, amortized over several frames so that a big fight doesn't cost one frame
+		// too much time. Keep the last decision until the running simulation finishes.
+		// CombatCommander gives squads different phases, so they start on different frames.
+		const int now = BWAPI::Broodwar->getFrameCount();
+
+		// A simulation that was not advanced last frame is out of date.
+		if (_combatSim.isRunning() && _combatSimFrame != now - 1)
+		{
+			_combatSim.stop();
+		}
+
+		if (!_combatSim.isRunning() && now % CombatSimulation::AmortizedFrames() == _combatSimPhase)
+		{
+			_combatSim.setCombatUnits(unitClosest->getPosition(), _combatSimRadius, _fightVisibleOnly);
+		}
+
+		if (_combatSim.isRunning())
+		{
+			_combatSimFrame = now;
+			if (_combatSim.advance(Config::Micro::CombatSimFramesPerTick))
+			{
+				_lastRetreatSwitch = now;
+				_lastRetreatSwitchVal = _combatSim.getScore() < 0;
+			}
+		}
+
+		retreat = _lastRetreatSwitchVal;
+	}
 	
 	if (retreat)
 	{
@@ -483,17 +517,17 @@ BWAPI::Position Squad::calcRegroupPosition()
 	if (regroup == BWAPI::Position(0,0))
 	{
 		// Retreat to the main base (guaranteed not null, even if the buildings were destroyed).
-		regroup = BWTA::getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition())->getCenter();
+		regroup = MapAnalysis::Instance().getRegion(InformationManager::Instance().getMyMainBaseLocation()->getTilePosition())->getCenter();
 
 		// If the natural has been taken, retreat there instead.
-		BWTA::BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
+		BaseLocation * natural = InformationManager::Instance().getMyNaturalLocation();
 		if (natural && InformationManager::Instance().getBaseOwner(natural) == BWAPI::Broodwar->self())
 		{
 			// If we have a wall, use its door location
 			if (BuildingPlacer::Instance().getWall().exists())
 				regroup = BuildingPlacer::Instance().getWall().gapCenter;
 			else
-				regroup = BWTA::getRegion(natural->getTilePosition())->getCenter();
+				regroup = MapAnalysis::Instance().getRegion(natural->getTilePosition())->getCenter();
 		}
 	}
 
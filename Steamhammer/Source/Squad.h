@@ -34,6 +34,9 @@ class Squad
 	bool				_attackAtMax;       // turns true when we are at max supply
     int                 _lastRetreatSwitch;
     bool                _lastRetreatSwitchVal;
+	CombatSimulation	_combatSim;			// amortized combat sim, spread over several frames
+	int					_combatSimPhase;	// start combat sims when frame % CombatSimulation::AmortizedFrames() == this
+	int					_combatSimFrame;	// last frame the running combat sim advanced
     size_t              _priority;
 	
 	SquadOrder          _order;
@@ -91,6 +94,8 @@ public:
 	int					getCombatSimRadius() const { return _combatSimRadius; };
 	void				setCombatSimRadius(int radius) { _combatSimRadius = radius; };
 
+	void				setCombatSimPhase(int phase) { _combatSimPhase = phase; };
+
 	bool				getFightVisible() const { return _fightVisibleOnly; };
 	void				setFightVisible(bool visibleOnly) { _fightVisibleOnly = visibleOnly; };
 
@@ -4,12 +4,15 @@
  *----------------------------------------------------------------------
  */
 
+#include <thread>
+
 #include "JSONTools.h"
 
 #include "UAlbertaBotModule.h"
 
 #include "Bases.h"
 #include "Common.h"
+#include "MapAnalysis.h"
 #include "OpponentModel.h"
 #include "ParseUtils.h"
 #include "UnitUtil.h"
@@ -25,31 +28,43 @@ void UAlbertaBotModule::onStart()
     // Uncomment this when we need to debug log stuff before the config file is parsed
     //Config::Debug::LogDebug = true;
 
-    // Initialize BOSS, the Build Order Search System
-    BOSS::init();
-
-	// Call BWTA to read and analyze the current map.
-	// Very slow if the map has not been seen before, so that info is not cached.
-	BWTA::readMap();
-	BWTA::analyze();
+	// The startup stages run one after another. Each is timed for the log.
+	// Running the independent ones (BOSS, the opponent model file) alongside the map analysis saved
+	// only a few ms, since the map analysis is itself a chain: BWEM, then Bases (which uses BWEM),
+	// then BWEB (whose building placer uses the InformationManager, which uses the bases).
+	BOSS::Timer startupTimer;
+	startupTimer.start();
 
-	// Our own map analysis.
-	Bases::Instance().initialize();
+	// Initialize BOSS, the Build Order Search System
+	BOSS::init();
+	double bossMS = startupTimer.getElapsedTimeInMilliSec();
 
-	// BWEM map init
-	bwemMap.Initialize();
+	// BWEM map init. BWEM is fast enough to run on every game, no cache needed.
+	// Its per-area stages can use every core; the result does not depend on the thread count.
+	bwemMap.Initialize(int(std::thread::hardware_concurrency()));
 	bwemMap.EnableAutomaticPathAnalysis();
 	bool startingLocationsOK = bwemMap.FindBasesForStartingLocations();
 	UAB_ASSERT(startingLocationsOK, "BWEM map analysis failed");
 
-    // BWEB map init
-    BuildingPlacer::Instance().initializeBWEB();
+	// Base locations, regions and chokepoints for the rest of the bot, from BWEM.
+	MapAnalysis::Instance().initialize();
+	double bwemMS = startupTimer.getElapsedTimeInMilliSec() - bossMS;
+
+	// Our own map analysis.
+	Bases::Instance().initialize();
+	double basesMS = startupTimer.getElapsedTimeInMilliSec() - bossMS - bwemMS;
+
+	// BWEB map init
+	BuildingPlacer::Instance().initializeBWEB();
+	double bwebMS = startupTimer.getElapsedTimeInMilliSec() - bossMS - bwemMS - basesMS;
 
-    // Parse the bot's configuration file.
+	// Parse the bot's configuration file. This also reads and analyzes the opponent model.
 	// Change this file path to point to your config file.
-    // Any relative path name will be relative to Starcraft installation folder
+	// Any relative path name will be relative to Starcraft installation folder
 	// The config depends on the map and must be read after the map is analyzed.
-    ParseUtils::ParseConfigFile(Config::ConfigFile::ConfigFileLocation);
+	ParseUtils::ParseConfigFile(Config::ConfigFile::ConfigFileLocation);
+	double startupMS = startupTimer.getElapsedTimeInMilliSec();
+	double configMS = startupMS - bossMS - bwemMS - basesMS - bwebMS;
 
     // Set our BWAPI options according to the configuration. 
 	BWAPI::Broodwar->setLocalSpeed(Config::BWAPIOptions::SetLocalSpeed);
@@ -66,6 +81,8 @@ void UAlbertaBotModule::onStart()
     }
 
 	Log().Get() << "I am Locutus of Borg, you are " << InformationManager::Instance().getEnemyName() << ", we're in " << BWAPI::Broodwar->mapFileName();
+	Log().Get() << "Startup took " << startupMS << "ms: " << bossMS << "ms (BOSS), " << bwemMS << "ms (BWEM), "
+		<< basesMS << "ms (bases), " << bwebMS << "ms (BWEB), " << configMS << "ms (config and opponent model)";
 
 	StrategyManager::Instance().setOpeningGroup();    // may depend on config and/or opponent model
 
@@ -79,6 +96,8 @@ void UAlbertaBotModule::onEnd(bool isWinner)
 {
 	OpponentModel::Instance().setWin(isWinner);
 	OpponentModel::Instance().write();
+
+	WorkerManager::Instance().logMiningBenchmark();
 }
 
 void UAlbertaBotModule::onFrame()
@@ -121,15 +140,27 @@ void UAlbertaBotModule::onFrame()
 		}
 
 		Log().Get() << "Summary: " << count << " combat units, " << UnitUtil::GetCompletedUnitCount(BWAPI::UnitTypes::Protoss_Probe) << " workers, " << BWAPI::Broodwar->self()->minerals() << " minerals, " << BWAPI::Broodwar->self()->gas() << " gas";
+		Log().Get() << "Production queue: " << ProductionManager::Instance().getQueueEvaluations() << " evaluations, " << ProductionManager::Instance().getSkippedEvaluations() << " skipped as not ready";
 	}
 }
 
 void UAlbertaBotModule::onUnitDestroy(BWAPI::Unit unit)
 {
 	if (unit->getType().isMineralField())
+	{
+		const BWEM::Mineral * mineral = bwemMap.GetMineral(unit);
+		bool blocking = mineral && mineral->Blocking();
 		bwemMap.OnMineralDestroyed(unit);
+		if (blocking)
+		{
+			MapAnalysis::Instance().onBlockingNeutralDestroyed();
+		}
+	}
 	else if (unit->getType().isSpecialBuilding())
+	{
 		bwemMap.OnStaticBuildingDestroyed(unit);
+		MapAnalysis::Instance().onBlockingNeutralDestroyed();
+	}
 
 	bwebMap.onUnitDestroy(unit);
 
@@ -427,119 +427,188 @@ int UnitUtil::GetWeaponDamageToWorker(BWAPI::Unit attacker)
 	return damage;
 }
 
-// All our units, whether completed or not.
-int UnitUtil::GetAllUnitCount(BWAPI::UnitType type)
+namespace
 {
-    int count = 0;
-    for (const auto unit : BWAPI::Broodwar->self()->getUnits())
-    {
-        if (unit->getType() == type)
-        {
-            ++count;
-        }
-
-        // Units in the egg.
-        else if (unit->getType() == BWAPI::UnitTypes::Zerg_Egg && unit->getBuildType() == type)
-        {
-            count += type.isTwoUnitsInOneEgg() ? 2 : 1;
-        }
-
-		// Lurkers in the egg.
-		else if (unit->getType() == BWAPI::UnitTypes::Zerg_Lurker_Egg && type == BWAPI::UnitTypes::Zerg_Lurker)
-		{
-			++count;
-		}
+	// Counts of our units, indexed by unit type ID.
+	// The counting rules are those of the original per-call scans, folded into a single pass.
+	struct UnitCountTable
+	{
+		int all[BWAPI::UnitTypes::Enum::MAX];			// completed or not, including units in eggs and cocoons
+		int completed[BWAPI::UnitTypes::Enum::MAX];
+		int uncompleted[BWAPI::UnitTypes::Enum::MAX];	// including units in eggs and cocoons
+		int inEgg[BWAPI::UnitTypes::Enum::MAX];			// in an egg, lurker egg, or cocoon
 
-		// Guardians or devourers in the cocoon.
-		else if (unit->getType() == BWAPI::UnitTypes::Zerg_Cocoon && unit->getBuildType() == type)
-		{
-			++count;
-		}
+		// Our units by type, in the order of self()->getUnits().
+		std::vector<BWAPI::Unit> units[BWAPI::UnitTypes::Enum::MAX];
 
-        // case where a building has started constructing a unit but it doesn't yet have a unit associated with it
-        else if (unit->getRemainingTrainTime() > 0)
-        {
-            BWAPI::UnitType trainType = unit->getLastCommand().getUnitType();
+		int frame;										// frame the table was built, -1 if invalid
 
-			// NOTE Comparing the time like this could lead to miscounts if units start simultaneously.
-			//      But the original UAlbertaBot production system does not start units simultaneously.
-            if (trainType == type && unit->getRemainingTrainTime() == trainType.buildTime())
-            {
-                ++count;
-            }
-        }
-    }
+		UnitCountTable() : frame(-1) {}
+	};
 
-    return count;
-}
+	UnitCountTable unitCounts;
 
-// Only our completed units.
-int UnitUtil::GetCompletedUnitCount(BWAPI::UnitType type)
-{
-	int count = 0;
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
+	void AddCount(int counts[], BWAPI::UnitType type, int n)
 	{
-		if (unit->getType() == type && unit->isCompleted())
+		if (type.getID() >= 0 && type.getID() < BWAPI::UnitTypes::Enum::MAX)
 		{
-			++count;
+			counts[type.getID()] += n;
 		}
 	}
 
-	return count;
-}
-
-// Only our incomplete units.
-int UnitUtil::GetUncompletedUnitCount(BWAPI::UnitType type)
-{
-	int count = 0;
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
+	void UpdateUnitCounts()
 	{
-		// Units in the egg.
-		if (unit->getType() == BWAPI::UnitTypes::Zerg_Egg && unit->getBuildType() == type)
+		if (unitCounts.frame == BWAPI::Broodwar->getFrameCount())
 		{
-			count += type.isTwoUnitsInOneEgg() ? 2 : 1;
+			return;
 		}
 
-		// Lurkers in the egg.
-		else if (unit->getType() == BWAPI::UnitTypes::Zerg_Lurker_Egg && type == BWAPI::UnitTypes::Zerg_Lurker)
+		std::fill(unitCounts.all, unitCounts.all + BWAPI::UnitTypes::Enum::MAX, 0);
+		std::fill(unitCounts.completed, unitCounts.completed + BWAPI::UnitTypes::Enum::MAX, 0);
+		std::fill(unitCounts.uncompleted, unitCounts.uncompleted + BWAPI::UnitTypes::Enum::MAX, 0);
+		std::fill(unitCounts.inEgg, unitCounts.inEgg + BWAPI::UnitTypes::Enum::MAX, 0);
+		for (std::vector<BWAPI::Unit> & units : unitCounts.units)
 		{
-			++count;
+			units.clear();
 		}
 
-		// Guardians or devourers in the cocoon.
-		else if (unit->getType() == BWAPI::UnitTypes::Zerg_Cocoon && unit->getBuildType() == type)
+		for (const auto unit : BWAPI::Broodwar->self()->getUnits())
 		{
-			++count;
-		}
+			const BWAPI::UnitType type = unit->getType();
+			const bool isCompleted = unit->isCompleted();
 
-		// case where a building has started constructing a unit but it doesn't yet have a unit associated with it
-		else if (unit->getRemainingTrainTime() > 0)
-		{
-			BWAPI::UnitType trainType = unit->getLastCommand().getUnitType();
+			if (type.getID() >= 0 && type.getID() < BWAPI::UnitTypes::Enum::MAX)
+			{
+				unitCounts.units[type.getID()].push_back(unit);
+			}
 
+			// The unit in the egg, if any.
+			BWAPI::UnitType eggType = BWAPI::UnitTypes::None;
+			int eggCount = 0;
+			if (type == BWAPI::UnitTypes::Zerg_Egg)
+			{
+				eggType = unit->getBuildType();
+				eggCount = eggType.isTwoUnitsInOneEgg() ? 2 : 1;
+			}
+			else if (type == BWAPI::UnitTypes::Zerg_Lurker_Egg)
+			{
+				eggType = BWAPI::UnitTypes::Zerg_Lurker;
+				eggCount = 1;
+			}
+			else if (type == BWAPI::UnitTypes::Zerg_Cocoon)
+			{
+				eggType = unit->getBuildType();
+				eggCount = 1;
+			}
+
+			// A building that has started constructing a unit, before the unit exists.
 			// NOTE Comparing the time like this could lead to miscounts if units start simultaneously.
 			//      But the original UAlbertaBot production system does not start units simultaneously.
-			if (trainType == type && unit->getRemainingTrainTime() == trainType.buildTime())
+			BWAPI::UnitType trainType = BWAPI::UnitTypes::None;
+			if (unit->getRemainingTrainTime() > 0)
+			{
+				BWAPI::UnitType lastCommandType = unit->getLastCommand().getUnitType();
+				if (unit->getRemainingTrainTime() == lastCommandType.buildTime())
+				{
+					trainType = lastCommandType;
+				}
+			}
+
+			// All units.
+			AddCount(unitCounts.all, type, 1);
+			if (eggCount > 0)
+			{
+				AddCount(unitCounts.all, eggType, eggCount);
+			}
+			if (trainType != BWAPI::UnitTypes::None && trainType != type && (eggCount == 0 || trainType != eggType))
+			{
+				AddCount(unitCounts.all, trainType, 1);
+			}
+
+			// Completed units.
+			if (isCompleted)
+			{
+				AddCount(unitCounts.completed, type, 1);
+			}
+
+			// Uncompleted units.
+			if (eggCount > 0)
+			{
+				AddCount(unitCounts.uncompleted, eggType, eggCount);
+				AddCount(unitCounts.inEgg, eggType, eggCount);
+			}
+			if (trainType != BWAPI::UnitTypes::None && (eggCount == 0 || trainType != eggType))
+			{
+				AddCount(unitCounts.uncompleted, trainType, 1);
+			}
+			if (!isCompleted && trainType != type)
 			{
-				++count;
+				AddCount(unitCounts.uncompleted, type, 1);
 			}
 		}
 
-		// The basic case.
-		else if (unit->getType() == type && !unit->isCompleted())
+		unitCounts.frame = BWAPI::Broodwar->getFrameCount();
+	}
+
+	int ReadUnitCount(const int counts[], BWAPI::UnitType type)
+	{
+		UpdateUnitCounts();
+		if (type.getID() >= 0 && type.getID() < BWAPI::UnitTypes::Enum::MAX)
 		{
-			++count;
+			return counts[type.getID()];
 		}
+		return 0;
+	}
+}
+
+// All our units, whether completed or not.
+// Units in eggs and cocoons count, and so do units whose production started this frame.
+int UnitUtil::GetAllUnitCount(BWAPI::UnitType type)
+{
+	return ReadUnitCount(unitCounts.all, type);
+}
+
+// Only our completed units.
+int UnitUtil::GetCompletedUnitCount(BWAPI::UnitType type)
+{
+	return ReadUnitCount(unitCounts.completed, type);
+}
+
+// Only our incomplete units.
+int UnitUtil::GetUncompletedUnitCount(BWAPI::UnitType type)
+{
+	return ReadUnitCount(unitCounts.uncompleted, type);
+}
+
+// Only our units in eggs, lurker eggs and cocoons.
+int UnitUtil::GetInEggUnitCount(BWAPI::UnitType type)
+{
+	return ReadUnitCount(unitCounts.inEgg, type);
+}
+
+// Our units of the type, completed or not. Eggs and cocoons are listed under their own types.
+const std::vector<BWAPI::Unit> & UnitUtil::GetUnitsOfType(BWAPI::UnitType type)
+{
+	static const std::vector<BWAPI::Unit> none;
+
+	UpdateUnitCounts();
+	if (type.getID() >= 0 && type.getID() < BWAPI::UnitTypes::Enum::MAX)
+	{
+		return unitCounts.units[type.getID()];
 	}
+	return none;
+}
 
-	return count;
+void UnitUtil::InvalidateUnitCounts()
+{
+	unitCounts.frame = -1;
 }
 
 BWAPI::Unit UnitUtil::GetNextCompletedBuildingOfType(BWAPI::UnitType type)
 {
 	int bestFrame = INT_MAX;
 	BWAPI::Unit bestUnit = nullptr;
-	for (const auto unit : BWAPI::Broodwar->self()->getUnits())
+	for (const auto unit : GetUnitsOfType(type))
 	{
 		if (unit->getType() == type && unit->isBeingConstructed() && unit->getRemainingBuildTime() < bestFrame)
 			bestFrame = unit->getRemainingBuildTime(), bestUnit = unit;
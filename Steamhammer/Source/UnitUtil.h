@@ -39,9 +39,19 @@ namespace UnitUtil
 	bool GoodUnderDarkSwarm(BWAPI::Unit attacker);
 	bool GoodUnderDarkSwarm(BWAPI::UnitType attacker);
 
+	// Our unit counts by type. These read a table that is rebuilt at most once per frame,
+	// plus once after each invalidation.
 	int GetAllUnitCount(BWAPI::UnitType type);
 	int GetCompletedUnitCount(BWAPI::UnitType type);
 	int GetUncompletedUnitCount(BWAPI::UnitType type);
+	int GetInEggUnitCount(BWAPI::UnitType type);
+
+	// Our units of a type, from the same table. The reference is good until the next invalidation.
+	const std::vector<BWAPI::Unit> & GetUnitsOfType(BWAPI::UnitType type);
+
+	// Call on unit events, and after giving an order that starts training or morphing a unit.
+	// BWAPI's latency compensation updates the unit immediately, in the same frame.
+	void InvalidateUnitCounts();
 
 	BWAPI::Unit GetNextCompletedBuildingOfType(BWAPI::UnitType type);
 };
@@ -3,6 +3,16 @@
 
 using namespace UAlbertaBot;
 
+namespace
+{
+	// A mineral worker that adds less income than this (in minerals per frame) is not useful.
+	// One worker on an uncrowded patch mines about 0.045 per frame.
+	const double MinUsefulMineralIncome = 0.01;
+
+	// Trust the model's worker limit once it has seen this many trips.
+	const int MinTrainingTrips = 40;
+}
+
 WorkerData::WorkerData() 
 {
     for (const auto unit : BWAPI::Broodwar->getAllUnits())
@@ -20,6 +30,105 @@ void WorkerData::workerDestroyed(BWAPI::Unit unit)
 
 	clearPreviousJob(unit);
 	workers.erase(unit);
+	miningModel.workerRemoved(unit);
+}
+
+// Watch the mineral workers' trips, and now and then recompute what the next worker is worth.
+void WorkerData::updateMiningModel()
+{
+	for (const auto worker : workers)
+	{
+		if (workerJobMap[worker] == Minerals && worker->isCompleted())
+		{
+			miningModel.observe(worker, workerMineralAssignment[worker], workerDepotMap[worker]);
+		}
+	}
+
+	if (BWAPI::Broodwar->getFrameCount() % 24 != 0)
+	{
+		return;
+	}
+
+	// Two depots can share patches, so count each patch once, for the first depot.
+	std::set<BWAPI::Unit> patchesSeen;
+	depotMineralWorkerLimit.clear();
+	depotMarginalIncome.clear();
+	for (const auto depot : depots)
+	{
+		int & limit = depotMineralWorkerLimit[depot];
+		double & marginal = depotMarginalIncome[depot];
+		for (const auto mineral : getMineralPatchesNearDepot(depot))
+		{
+			if (!patchesSeen.insert(mineral).second)
+			{
+				continue;
+			}
+
+			const MiningModel::PatchTimes & times = miningModel.getTimes(mineral, depot);
+			marginal = std::max(marginal, MiningModel::MarginalIncome(times, workersOnMineralPatch[mineral]));
+
+			int n = 0;
+			while (n < 10 && MiningModel::MarginalIncome(times, n) >= MinUsefulMineralIncome)
+			{
+				++n;
+			}
+			limit += n;
+		}
+	}
+}
+
+// Mineral workers that each add useful income, over all bases.
+int WorkerData::getMineralWorkerLimit() const
+{
+	int limit = 0;
+	for (const auto & depotLimit : depotMineralWorkerLimit)
+	{
+		limit += depotLimit.second;
+	}
+	return limit;
+}
+
+int WorkerData::getMineralWorkerLimit(BWAPI::Unit depot) const
+{
+	auto it = depotMineralWorkerLimit.find(depot);
+	return it == depotMineralWorkerLimit.end() ? 0 : it->second;
+}
+
+// What the next mineral worker adds at the base where it adds the most.
+double WorkerData::getMarginalMineralIncome() const
+{
+	double marginal = 0.0;
+	for (const auto & depotMarginal : depotMarginalIncome)
+	{
+		marginal = std::max(marginal, depotMarginal.second);
+	}
+	return marginal;
+}
+
+double WorkerData::getMarginalMineralIncome(BWAPI::Unit depot) const
+{
+	auto it = depotMarginalIncome.find(depot);
+	return it == depotMarginalIncome.end() ? 0.0 : it->second;
+}
+
+bool WorkerData::isMiningModelTrained() const
+{
+	return miningModel.getTrips() >= MinTrainingTrips;
+}
+
+// The times of each patch that has workers assigned,
+// for running the mining simulator on the current situation.
+void WorkerData::getMiningPatchTimes(std::vector<MiningModel::PatchTimes> & times)
+{
+	times.clear();
+	for (const auto & assignment : workersOnMineralPatch)
+	{
+		if (assignment.second > 0 && assignment.first && assignment.first->exists())
+		{
+			BWAPI::Unit depot = BWAPI::Broodwar->getClosestUnit(assignment.first->getPosition(), BWAPI::Filter::IsResourceDepot && BWAPI::Filter::IsOwned, 400);
+			times.push_back(miningModel.getTimes(assignment.first, depot));
+		}
+	}
 }
 
 void WorkerData::addWorker(BWAPI::Unit unit)
@@ -311,6 +420,14 @@ bool WorkerData::depotIsFull(BWAPI::Unit depot)
 	int assignedWorkers = getNumAssignedWorkers(depot);
 	int mineralsNearDepot = getMineralsNearDepot(depot);
 
+	// Once the mining model is trained, a base is also full when another worker there would only wait.
+	// A depot added since the last model update has no limit yet.
+	auto limit = depotMineralWorkerLimit.find(depot);
+	if (isMiningModelTrained() && limit != depotMineralWorkerLimit.end() && assignedWorkers >= limit->second)
+	{
+		return true;
+	}
+
 	return assignedWorkers >= int (Config::Macro::WorkersPerPatch * mineralsNearDepot + 0.5);
 }
 
@@ -389,6 +506,11 @@ BWAPI::Unit WorkerData::getWorkerResource(BWAPI::Unit unit)
 	return nullptr;
 }
 
+// Choose the patch where one more worker adds the most income, according to the mining model.
+// That keeps workers off patches where they would only wait for another worker to finish.
+// Ties (usually between patches that are already full) go to the patch with fewer workers,
+// then to the closer patch. With MineByMarginalIncome off, every patch ties, which is the
+// old fewest-workers assignment; the game end log compares the two from observed income.
 BWAPI::Unit WorkerData::getMineralToMine(BWAPI::Unit worker)
 {
 	if (!worker) { return nullptr; }
@@ -396,6 +518,7 @@ BWAPI::Unit WorkerData::getMineralToMine(BWAPI::Unit worker)
 	// get the depot associated with this unit
 	BWAPI::Unit depot = getWorkerDepot(worker);
 	BWAPI::Unit bestMineral = nullptr;
+	double bestGain = -1.0;
 	int bestDist = 100000;
     int bestNumAssigned = 10000;
 
@@ -407,11 +530,25 @@ BWAPI::Unit WorkerData::getMineralToMine(BWAPI::Unit worker)
 		{
 				int dist = mineral->getDistance(depot);
                 int numAssigned = workersOnMineralPatch[mineral];
-
-                if (numAssigned < bestNumAssigned ||
-					numAssigned == bestNumAssigned && dist < bestDist)
+				double gain = Config::Macro::MineByMarginalIncome
+					? MiningModel::MarginalIncome(miningModel.getTimes(mineral, depot), numAssigned)
+					: 0.0;
+
+				bool better;
+				if (std::abs(gain - bestGain) > 1e-9)
+				{
+					better = gain > bestGain;
+				}
+				else
+				{
+					better = numAssigned < bestNumAssigned ||
+						(numAssigned == bestNumAssigned && dist < bestDist);
+				}
+
+                if (better)
                 {
                     bestMineral = mineral;
+					bestGain = gain;
                     bestDist = dist;
                     bestNumAssigned = numAssigned;
                 }
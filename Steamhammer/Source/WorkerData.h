@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "MiningModel.h"
 
 namespace UAlbertaBot
 {
@@ -47,6 +48,10 @@ private:
     std::map<BWAPI::Unit, int>				workersOnMineralPatch;  // workers per mineral patch
     std::map<BWAPI::Unit, BWAPI::Unit>		workerMineralAssignment;// worker -> mineral patch
 
+	MiningModel		miningModel;
+	std::map<BWAPI::Unit, int>		depotMineralWorkerLimit;	// depot -> mineral workers that each add useful income
+	std::map<BWAPI::Unit, double>	depotMarginalIncome;		// depot -> minerals per frame from its next mineral worker
+
 	void clearPreviousJob(BWAPI::Unit unit);
 
 public:
@@ -54,6 +59,7 @@ public:
 	WorkerData();
 
 	void					workerDestroyed(BWAPI::Unit unit);
+	void					updateMiningModel();
 	void					addDepot(BWAPI::Unit unit);
 	void					removeDepot(BWAPI::Unit unit);
 	void					addWorker(BWAPI::Unit unit);
@@ -82,6 +88,14 @@ public:
 	int						getNumAssignedWorkers(BWAPI::Unit unit);
 	BWAPI::Unit				getMineralToMine(BWAPI::Unit worker);
 
+	bool					isMiningModelTrained() const;
+	int						getMineralWorkerLimit() const;
+	int						getMineralWorkerLimit(BWAPI::Unit depot) const;
+	double					getMarginalMineralIncome() const;
+	double					getMarginalMineralIncome(BWAPI::Unit depot) const;
+	double					getObservedMineralsPerMinute() const { return miningModel.getObservedMineralsPerMinute(); };
+	void					getMiningPatchTimes(std::vector<MiningModel::PatchTimes> & times);
+
 	enum WorkerJob			getWorkerJob(BWAPI::Unit unit);
 	BWAPI::Unit				getWorkerResource(BWAPI::Unit unit);
 	BWAPI::Unit				getWorkerDepot(BWAPI::Unit unit);
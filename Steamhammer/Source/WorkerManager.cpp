@@ -23,6 +23,7 @@ void WorkerManager::update()
 	// NOTE Combat workers are placed in a combat squad and get their orders there.
 	//      We ignore them here.
 	updateWorkerStatus();
+	workerData.updateMiningModel();
 	handleGasWorkers();
 	handleIdleWorkers();
 	handleReturnCargoWorkers();
@@ -980,10 +981,38 @@ int WorkerManager::getMaxWorkers() const
 
 	// Never let the max number of workers fall to 0!
 	// Set aside 1 for future opportunities.
-	return std::min(
+	int maxWorkers = std::min(
 			Config::Macro::AbsoluteMaxWorkers,
 			1 + int(std::round(Config::Macro::WorkersPerPatch * patches + Config::Macro::WorkersPerRefinery * refineries))
 		);
+
+	// Once the mining model has seen enough trips, don't make mineral workers
+	// that would mostly wait in line at the patches.
+	if (workerData.isMiningModelTrained())
+	{
+		maxWorkers = std::min(maxWorkers,
+			1 + workerData.getMineralWorkerLimit() + int(std::round(Config::Macro::WorkersPerRefinery * refineries)));
+	}
+
+	return maxWorkers;
+}
+
+// Log the mineral income the workers actually delivered over the last minute, under the
+// assignment policy this game used. Games played with MineByMarginalIncome on and off
+// compare the policies by observed income. The simulator's predictions for the same
+// workers and learned patch times are logged beside it, to show how far to trust the model.
+void WorkerManager::logMiningBenchmark()
+{
+	std::vector<MiningModel::PatchTimes> patches;
+	workerData.getMiningPatchTimes(patches);
+	const int workers = workerData.getNumMineralWorkers();
+	const int frames = 5 * 60 * 24;
+
+	Log().Get() << "Mining: " << workers << " mineral workers on " << patches.size() << " patches, "
+		<< "assigned by " << (Config::Macro::MineByMarginalIncome ? "marginal income" : "fewest workers") << ", "
+		<< int(workerData.getObservedMineralsPerMinute()) << " minerals/minute observed; predicted "
+		<< int(MiningSimulator::MineralsPerMinute(patches, workers, frames, true)) << " by marginal income, "
+		<< int(MiningSimulator::MineralsPerMinute(patches, workers, frames, false)) << " by fewest workers";
 }
 
 // Mine out any blocking minerals that the worker runs headlong into.
@@ -56,6 +56,14 @@ public:
 	int         getNumIdleWorkers() const;
 	int			getMaxWorkers() const;
 
+	// From the mining model: what the next mineral worker would add, in minerals per frame,
+	// and how many mineral workers our bases can use. Overall, or at the base of one depot.
+	double		getMarginalMineralIncome() const { return workerData.getMarginalMineralIncome(); };
+	double		getMarginalMineralIncome(BWAPI::Unit depot) const { return workerData.getMarginalMineralIncome(depot); };
+	int			getMineralWorkerLimit() const { return workerData.getMineralWorkerLimit(); };
+	int			getMineralWorkerLimit(BWAPI::Unit depot) const { return workerData.getMineralWorkerLimit(depot); };
+	void		logMiningBenchmark();
+
     void        setScoutWorker(BWAPI::Unit worker);
 
 	// NOTE _collectGas == false allows that a little more gas may still be collected.